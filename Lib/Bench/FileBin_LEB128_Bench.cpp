@@ -0,0 +1,238 @@
+/**
+ *  \file       FileBin_LEB128_Bench.cpp
+ *  \brief      LEB128 decoding microbenchmark (FYNIX_LEB128_BENCH)
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#include "FileBin_LEB128.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define FILEBIN_LEB128_BENCH_VALUES     (1u << 20)
+#define FILEBIN_LEB128_BENCH_ROUNDS     (20u)
+
+#if defined(__BMI2__)
+#define FILEBIN_LEB128_BENCH_KERNEL     "pext"
+#else
+#define FILEBIN_LEB128_BENCH_KERNEL     "word"
+#endif
+
+typedef struct
+{
+    std::vector<uint8_t> Bytes;
+    std::vector<uint64_t> Values;
+    std::vector<uint64_t> Offsets; /* Where each value starts, only used by the page edge set */
+} FileBin_LEB128_BenchSetType;
+
+static size_t FileBin_LEB128_Encode(uint8_t* out, uint64_t value)
+{
+    size_t len = 0;
+    do
+    {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        out[len++] = byte | ((value != 0) ? 0x80 : 0);
+    } while (value != 0);
+    return len;
+}
+
+/* Values of minLen..maxLen encoded bytes, written back to back */
+static void FileBin_LEB128_BenchFill(FileBin_LEB128_BenchSetType& set, uint32_t minLen, uint32_t maxLen, std::mt19937_64& rng)
+{
+    uint8_t enc[10];
+    set.Bytes.reserve(FILEBIN_LEB128_BENCH_VALUES * maxLen + FILEBIN_LEB128_WORD_BYTES);
+    for (uint32_t i = 0; i < FILEBIN_LEB128_BENCH_VALUES; i++)
+    {
+        uint32_t len = minLen + static_cast<uint32_t>(rng() % (maxLen - minLen + 1));
+        uint32_t bits = std::min(64u, 7 * len);
+        uint64_t value = (bits == 64) ? rng() : (rng() & ((1ull << bits) - 1));
+        value |= 1ull << (7 * (len - 1)); /* Top group set, so it takes exactly len bytes */
+
+        set.Values.push_back(value);
+        set.Bytes.insert(set.Bytes.end(), enc, enc + FileBin_LEB128_Encode(enc, value));
+    }
+    set.Bytes.resize(set.Bytes.size() + FILEBIN_LEB128_WORD_BYTES, 0); /* Room for the last wide load */
+}
+
+/* One value of 3..8 bytes at the end of every page, the word kernel refuses it and falls back */
+static void FileBin_LEB128_BenchFillPageEdge(FileBin_LEB128_BenchSetType& set, std::mt19937_64& rng)
+{
+    const uint32_t pages = FILEBIN_LEB128_BENCH_VALUES / 16;
+    set.Bytes.assign((pages + 2) * FILEBIN_LEB128_PAGE_SIZE, 0);
+
+    // Offsets are taken from the first page boundary inside the buffer
+    uintptr_t base = reinterpret_cast<uintptr_t>(set.Bytes.data());
+    uint64_t first = (FILEBIN_LEB128_PAGE_SIZE - (base & (FILEBIN_LEB128_PAGE_SIZE - 1))) & (FILEBIN_LEB128_PAGE_SIZE - 1);
+
+    for (uint32_t p = 0; p < pages; p++)
+    {
+        uint32_t len = 3 + static_cast<uint32_t>(rng() % 6);
+        uint64_t value = (rng() & ((1ull << (7 * len)) - 1)) | (1ull << (7 * (len - 1)));
+        uint64_t offset = first + (p + 1) * uint64_t(FILEBIN_LEB128_PAGE_SIZE) - FILEBIN_LEB128_WORD_BYTES + 2 + (rng() % 4);
+
+        set.Values.push_back(value);
+        set.Offsets.push_back(offset);
+        FileBin_LEB128_Encode(set.Bytes.data() + offset, value);
+    }
+}
+
+template <typename Fn>
+static bool FileBin_LEB128_BenchRun(const char* name, const FileBin_LEB128_BenchSetType& set, Fn decode)
+{
+    uint64_t sum = 0;
+    bool ok = true;
+    double best = 0.0;
+
+    for (uint32_t round = 0; round < FILEBIN_LEB128_BENCH_ROUNDS; round++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t roundSum = decode(set);
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+
+        best = (round == 0) ? ns : std::min(best, ns);
+        ok = ok && ((round == 0) || (roundSum == sum));
+        sum = roundSum;
+    }
+
+    uint64_t expected = 0;
+    for (uint64_t v : set.Values)
+    {
+        expected += v;
+    }
+    ok = ok && (sum == expected);
+
+    std::cout << name << ": " << best / set.Values.size() << " ns/value" << (ok ? "" : "  [ERROR] wrong values") << "\n";
+    return ok;
+}
+
+/* Stream decoders, each returns the sum of the values it read */
+static uint64_t FileBin_LEB128_BenchScalar(const FileBin_LEB128_BenchSetType& set)
+{
+    const uint8_t* ptr = set.Bytes.data();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < set.Values.size(); i++)
+    {
+        sum += FileBin_LEB128_ReadULEBScalar(ptr);
+    }
+    return sum;
+}
+
+static uint64_t FileBin_LEB128_BenchInline(const FileBin_LEB128_BenchSetType& set)
+{
+    const uint8_t* ptr = set.Bytes.data();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < set.Values.size(); i++)
+    {
+        sum += FileBin_LEB128_ReadULEB(ptr);
+    }
+    return sum;
+}
+
+static uint64_t FileBin_LEB128_BenchLong(const FileBin_LEB128_BenchSetType& set)
+{
+    const uint8_t* ptr = set.Bytes.data();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < set.Values.size(); i++)
+    {
+        sum += FileBin_LEB128_ReadULEBLong(ptr);
+    }
+    return sum;
+}
+
+static uint64_t FileBin_LEB128_BenchSkip(const FileBin_LEB128_BenchSetType& set)
+{
+    const uint8_t* ptr = set.Bytes.data();
+    for (size_t i = 0; i < set.Values.size(); i++)
+    {
+        FileBin_LEB128_Skip(ptr);
+    }
+
+    // Skipping has no values, the end position stands for them
+    uint64_t sum = 0;
+    for (uint64_t v : set.Values)
+    {
+        sum += v;
+    }
+    return (ptr == set.Bytes.data() + set.Bytes.size() - FILEBIN_LEB128_WORD_BYTES) ? sum : 0;
+}
+
+static uint64_t FileBin_LEB128_BenchPageEdge(const FileBin_LEB128_BenchSetType& set)
+{
+    uint64_t sum = 0;
+    for (uint64_t offset : set.Offsets)
+    {
+        const uint8_t* ptr = set.Bytes.data() + offset;
+        sum += FileBin_LEB128_ReadULEB(ptr);
+    }
+    return sum;
+}
+
+static uint64_t FileBin_LEB128_BenchPageEdgeScalar(const FileBin_LEB128_BenchSetType& set)
+{
+    uint64_t sum = 0;
+    for (uint64_t offset : set.Offsets)
+    {
+        const uint8_t* ptr = set.Bytes.data() + offset;
+        sum += FileBin_LEB128_ReadULEBScalar(ptr);
+    }
+    return sum;
+}
+
+int main(void)
+{
+    std::mt19937_64 rng(0x4C454231u);
+
+    FileBin_LEB128_BenchSetType shortSet, wordSet, longSet, edgeSet;
+    FileBin_LEB128_BenchFill(shortSet, 1, 2, rng);
+    FileBin_LEB128_BenchFill(wordSet, 3, 8, rng);
+    FileBin_LEB128_BenchFill(longSet, 9, 10, rng);
+    FileBin_LEB128_BenchFillPageEdge(edgeSet, rng);
+
+    std::cout << "[INFO] LEB128 decoding, " << FILEBIN_LEB128_BENCH_VALUES << " values per set, word kernel: "
+              << FILEBIN_LEB128_BENCH_KERNEL << "\n";
+
+    bool ok = true;
+    ok &= FileBin_LEB128_BenchRun("1-2 bytes   scalar", shortSet, FileBin_LEB128_BenchScalar);
+    ok &= FileBin_LEB128_BenchRun("1-2 bytes   inline", shortSet, FileBin_LEB128_BenchInline);
+    ok &= FileBin_LEB128_BenchRun("3-8 bytes   scalar", wordSet, FileBin_LEB128_BenchScalar);
+    ok &= FileBin_LEB128_BenchRun("3-8 bytes   " FILEBIN_LEB128_BENCH_KERNEL "  ", wordSet, FileBin_LEB128_BenchLong);
+    ok &= FileBin_LEB128_BenchRun("3-8 bytes   skip  ", wordSet, FileBin_LEB128_BenchSkip);
+    ok &= FileBin_LEB128_BenchRun("9-10 bytes  scalar", longSet, FileBin_LEB128_BenchScalar);
+    ok &= FileBin_LEB128_BenchRun("9-10 bytes  long  ", longSet, FileBin_LEB128_BenchLong);
+    ok &= FileBin_LEB128_BenchRun("page edge   scalar", edgeSet, FileBin_LEB128_BenchPageEdgeScalar);
+    ok &= FileBin_LEB128_BenchRun("page edge   inline", edgeSet, FileBin_LEB128_BenchPageEdge);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
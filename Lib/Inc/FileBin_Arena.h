@@ -0,0 +1,131 @@
+/**
+ *  \file       FileBin_Arena.h
+ *  \brief      Bump arena for parser nodes and their payloads
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+#ifndef FILEBIN_ARENA_H
+#define FILEBIN_ARENA_H
+
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+/* Bump allocator. Memory is only given back when the arena is reset or destroyed, destructors
+ * of objects placed in it never run, so they must only own arena memory themselves.
+ * Not thread safe, use one arena per thread of work (e.g. per compilation unit) */
+class FileBin_Arena
+{
+    private:
+        std::vector<uint8_t*> Block;
+        uint8_t* Cur = nullptr;
+        uint8_t* End = nullptr;
+        size_t BlockSize;
+        size_t BytesUsed = 0;
+
+        void* AllocateSlow(size_t size, size_t align);
+
+    public:
+        explicit FileBin_Arena(size_t blockSize = 64 * 1024);
+        FileBin_Arena(const FileBin_Arena&) = delete;
+        FileBin_Arena& operator=(const FileBin_Arena&) = delete;
+        ~FileBin_Arena();
+
+        inline void* Allocate(size_t size, size_t align)
+        {
+            uintptr_t p = (reinterpret_cast<uintptr_t>(Cur) + (align - 1)) & ~static_cast<uintptr_t>(align - 1);
+
+            if ((Cur != nullptr) && (p + size <= reinterpret_cast<uintptr_t>(End)))
+            {
+                Cur = reinterpret_cast<uint8_t*>(p + size);
+                BytesUsed += size;
+                return reinterpret_cast<void*>(p);
+            }
+
+            return AllocateSlow(size, align);
+        }
+
+        template <typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        void Reset(void);
+        size_t GetBytesUsed(void) const;
+};
+
+/* STL allocator drawing from an arena, falls back to the heap when no arena is given */
+template <typename T>
+struct FileBin_ArenaAllocator
+{
+    typedef T value_type;
+
+    FileBin_Arena* Arena;
+
+    FileBin_ArenaAllocator(FileBin_Arena* arena = nullptr) noexcept : Arena(arena) {}
+
+    template <typename U>
+    FileBin_ArenaAllocator(const FileBin_ArenaAllocator<U>& other) noexcept : Arena(other.Arena) {}
+
+    T* allocate(size_t n)
+    {
+        if (Arena)
+        {
+            return static_cast<T*>(Arena->Allocate(n * sizeof(T), alignof(T)));
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        if (!Arena)
+        {
+            ::operator delete(p);
+        }
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const FileBin_ArenaAllocator<T>& a, const FileBin_ArenaAllocator<U>& b)
+{
+    return a.Arena == b.Arena;
+}
+
+template <typename T, typename U>
+inline bool operator!=(const FileBin_ArenaAllocator<T>& a, const FileBin_ArenaAllocator<U>& b)
+{
+    return a.Arena != b.Arena;
+}
+
+#endif // FILEBIN_ARENA_H
@@ -0,0 +1,73 @@
+/**
+ *  \file       FileBin_DIEIndex.h
+ *  \brief      DIE rows of all units by .debug_info offset
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#ifndef FILEBIN_DIEINDEX_H
+#define FILEBIN_DIEINDEX_H
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#define FILEBIN_DIEINDEX_SHARD_BITS     (4)
+#define FILEBIN_DIEINDEX_SHARD_CNT      (1u << FILEBIN_DIEINDEX_SHARD_BITS)
+
+/* DIE of any unit by its .debug_info offset, the target of references crossing units (DW_FORM_ref_addr).
+ * Units are indexed concurrently, each Insert() takes every shard lock at most once. Find() must not
+ * run while another thread inserts */
+class FileBin_DIEIndex
+{
+    public:
+        typedef struct
+        {
+            uint32_t Unit;  /* Index of the unit in parse order */
+            uint32_t Row;   /* Row in the DIE store of the unit */
+        } EntryType;
+
+    private:
+        typedef struct
+        {
+            std::mutex Lock;
+            std::unordered_map<uint64_t, EntryType> Entries;
+        } ShardType;
+
+        ShardType Shard[FILEBIN_DIEINDEX_SHARD_CNT];
+
+    public:
+        /* DIEs of one unit, offsets[i] is the .debug_info offset of rows[i] */
+        void Insert(uint32_t unit, const uint64_t* offsets, const uint32_t* rows, uint32_t count);
+        bool Find(uint64_t offset, EntryType& entry) const;
+        void Clear(void);
+};
+
+#endif // FILEBIN_DIEINDEX_H
@@ -0,0 +1,160 @@
+/**
+ *  \file       FileBin_DIEStore.h
+ *  \brief      Columnar storage of decoded DIEs
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef FILEBIN_DIESTORE_H
+#define FILEBIN_DIESTORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#define FILEBIN_DIESTORE_NONE           (0xFFFFFFFFu)  /* No row, ends a child or sibling chain */
+#define FILEBIN_DIESTORE_INLINE_DIMS    (2u)           /* Sizes kept in the row, more spill to a side table */
+
+#define FILEBIN_DIESTORE_FLAG_DECLARATION   (0x01u)    /* Forward declaration, not the definition */
+#define FILEBIN_DIESTORE_FLAG_TYPE_REF      (0x02u)    /* Type DIE lives in another unit, see the unit typeRefs */
+#define FILEBIN_DIESTORE_FLAG_ORIGIN_REF    (0x04u)    /* Completes a variable of another unit, see the unit originRefs */
+
+/* One column of the store. Either grown by the decoder, or borrowed from memory that outlives the
+ * store (a mapped symbol database) so loading it copies nothing. A borrowed column is read only until
+ * Own() copies it, appending does that by itself. Reads go through a single pointer in both cases */
+template <typename T>
+class FileBin_DIEColumn
+{
+    private:
+        std::vector<T> Owned;
+        T* Data = nullptr;
+        size_t BorrowedCnt = 0;
+        bool Borrowed = false;
+
+    public:
+        T& operator[](size_t idx) { return this->Data[idx]; }
+        const T& operator[](size_t idx) const { return this->Data[idx]; }
+        const T* data(void) const { return this->Data; }
+        size_t size(void) const { return this->Borrowed ? this->BorrowedCnt : this->Owned.size(); }
+
+        void push_back(const T& value)
+        {
+            if (this->Borrowed)
+            {
+                Own();
+            }
+            this->Owned.push_back(value);
+            this->Data = this->Owned.data();
+        }
+
+        void reserve(size_t cnt)
+        {
+            if (!this->Borrowed)
+            {
+                this->Owned.reserve(cnt);
+                this->Data = this->Owned.data();
+            }
+        }
+
+        void clear(void)
+        {
+            this->Owned.clear();
+            this->Data = this->Owned.data();
+            this->BorrowedCnt = 0;
+            this->Borrowed = false;
+        }
+
+        void Borrow(const T* data, size_t cnt)
+        {
+            this->Owned.clear();
+            this->Owned.shrink_to_fit();
+            this->Data = const_cast<T*>(data);
+            this->BorrowedCnt = cnt;
+            this->Borrowed = true;
+        }
+
+        void Own(void)
+        {
+            if (this->Borrowed)
+            {
+                this->Owned.assign(this->Data, this->Data + this->BorrowedCnt);
+                this->Data = this->Owned.data();
+                this->BorrowedCnt = 0;
+                this->Borrowed = false;
+            }
+        }
+};
+
+/* DIEs of one unit as parallel arrays, one row per DIE in decode order. Tree links are row indices, so
+ * walking siblings or scanning a single attribute touches only the columns involved. Rows never move
+ * once appended, children decoded later (lazy mode) are appended at the end and linked in */
+class FileBin_DIEStore
+{
+    private:
+        std::unordered_map<uint32_t, std::vector<uint32_t>> DimSpill; /* Sizes past the inline ones, by row */
+        std::unordered_map<uint32_t, const uint8_t*> Pending; /* Encoded children not decoded yet, by row */
+
+    public:
+        FileBin_DIEColumn<uint8_t> Tag;           /* Element type of the DIE */
+        FileBin_DIEColumn<uint8_t> Flags;         /* FILEBIN_DIESTORE_FLAG_* */
+        FileBin_DIEColumn<uint8_t> Encoding;      /* DW_AT_encoding of base types */
+        FileBin_DIEColumn<uint8_t> DimCount;      /* Sizes of the DIE (byte size, dimension count) */
+        FileBin_DIEColumn<uint32_t> Parent;
+        FileBin_DIEColumn<uint32_t> FirstChild;
+        FileBin_DIEColumn<uint32_t> Sibling;
+        FileBin_DIEColumn<uint32_t> NameId;
+        FileBin_DIEColumn<uint32_t> TypeOffset;   /* Unit relative, non-zero placeholder with FLAG_TYPE_REF */
+        FileBin_DIEColumn<uint32_t> Location;     /* Member offset within its structure */
+        FileBin_DIEColumn<uint64_t> Addr;         /* Static address of variables */
+        FileBin_DIEColumn<std::array<uint32_t, FILEBIN_DIESTORE_INLINE_DIMS>> Dims;
+
+        /* New row below parent (FILEBIN_DIESTORE_NONE for a root), not yet linked as a child or sibling */
+        uint32_t Append(uint8_t tag, uint32_t parent);
+        void AddDim(uint32_t row, uint32_t value);
+        uint32_t GetDim(uint32_t row, uint32_t idx) const; /* 0 past DimCount */
+
+        void SetPending(uint32_t row, const uint8_t* children);
+        const uint8_t* TakePending(uint32_t row); /* Returns and forgets the pending children, nullptr if none */
+        bool IsPending(uint32_t row) const;
+
+        /* Sizes past the inline ones, by row. Setting them does not touch DimCount */
+        const std::unordered_map<uint32_t, std::vector<uint32_t>>& GetDimSpill(void) const;
+        void SetDimSpill(uint32_t row, const uint32_t* values, uint32_t count);
+
+        void Reserve(uint32_t rows);
+        void Own(void); /* Copies the borrowed columns, the store no longer depends on their memory */
+        uint32_t Rows(void) const;
+        void Clear(void);
+};
+
+#endif // FILEBIN_DIESTORE_H
@@ -34,9 +34,21 @@
 #define FILEBIN_DWARF_H
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <vector>
 #include <unordered_map>
+#include <functional>
+#include <mutex>
+#include <deque>
+#include <memory>
+#include "FileBin_Endian.h"
+#include "FileBin_Arena.h"
+#include "FileBin_MappedFile.h"
+#include "FileBin_Search.h"
+#include "FileBin_StringPool.h"
+#include "FileBin_DIEStore.h"
+#include "FileBin_DIEIndex.h"
 
 typedef enum
 {
@@ -73,109 +85,458 @@ typedef enum
     FileBin_VARINFO_TYPE__LENGTH
 } FileBin_DWARF_VarInfoLenType;
 
+/* Node field an attribute is decoded into, resolved once per abbrev from its tag */
+typedef enum
+{
+    FILEBIN_DWARF_SLOT_NONE = 0,        /* Not used for this tag, skipped without decoding */
+    FILEBIN_DWARF_SLOT_NAME,
+    FILEBIN_DWARF_SLOT_TYPE,
+    FILEBIN_DWARF_SLOT_BYTE_SIZE,
+    FILEBIN_DWARF_SLOT_ENCODING,
+    FILEBIN_DWARF_SLOT_COUNT,
+    FILEBIN_DWARF_SLOT_UPPER_BOUND,
+    FILEBIN_DWARF_SLOT_MEMBER_LOCATION,
+    FILEBIN_DWARF_SLOT_LOCATION,
+    FILEBIN_DWARF_SLOT_DECLARATION,
+    FILEBIN_DWARF_SLOT_SPECIFICATION,
+    FILEBIN_DWARF_SLOT_SIBLING,         /* Only kept on tags whose children are skipped */
+} FileBin_DWARF_SlotType;
+
+/* Encoded size of a form that does not depend on the data, see FileBin_DWARF::FormFixedSize() */
+#define FILEBIN_DWARF_FORM_SIZE_VARIABLE    (-1)
+#define FILEBIN_DWARF_FORM_SIZE_ADDR        (-2)
+
+/* Abbrev codes up to this value are looked up in a dense table, larger ones in a map */
+#define FILEBIN_DWARF_ABBREV_DENSE_MAX      16384u
+
+/* On-disk symbol database, see FileBin_DWARF::SetCache(). Bump the version on any layout change */
+#define FILEBIN_DWARF_CACHE_VERSION         6u
+#define FILEBIN_DWARF_CACHE_EXTENSION       ".fbdb"
+
+/* unit_length escape announcing a 64-bit DWARF unit, the actual length follows on 8 bytes */
+#define FILEBIN_DWARF64_UNIT_LENGTH         0xffffffffu
+
+/* Average encoded DIE size, sizes the DIE store of a unit up front from its length */
+#define FILEBIN_DWARF_DIE_BYTES_ESTIMATE    8u
+
+/* A unit heavier than one worker's share of the symbol traversal is resolved as ranges of its top-level DIEs,
+ * about this many per worker share */
+#define FILEBIN_DWARF_RANGES_PER_WORKER     4u
+
 struct FileBin_DWARF_AbbrevAttr
 {
     uint64_t attribute;
     uint64_t form;
+    int8_t fixedSize = FILEBIN_DWARF_FORM_SIZE_VARIABLE;   /* Bytes to skip when unused, or FILEBIN_DWARF_FORM_SIZE_* */
+    FileBin_DWARF_SlotType slot = FILEBIN_DWARF_SLOT_NONE;
+    int64_t implicitConst = 0;  /* DW_FORM_implicit_const: the value is stored here, nothing in the DIE */
 };
 
+/* Abbrev compiled into a decode plan: element type, type registration and attribute slots are known
+ * before the first DIE using it is read */
 struct FileBin_DWARF_Abbrev
 {
-    uint32_t code;          // abbrev code (ULEB128)
-    uint32_t tag;           // DW_TAG_*
-    bool hasChildren;       // DW_CHILDREN_yes/no
+    uint32_t code = 0;          // abbrev code (ULEB128), 0 marks an unused dense table entry
+    uint32_t tag = 0;           // DW_TAG_*
+    bool hasChildren = false;   // DW_CHILDREN_yes/no
     std::vector<FileBin_DWARF_AbbrevAttr> attributes;
+
+    FileBin_DWARF_ElementType elementType = FILEBIN_DWARF_ELEMENT__UNKNOWN;
+    bool isType = false;        /* DIE is registered in the CU typeList under its offset */
+    bool skipChildren = false;  /* Subtree holds nothing we use (subprograms, lexical blocks) */
+    bool hasSlots = false;      /* At least one attribute has to be decoded */
+    int32_t fixedSize = 0;      /* Encoded size of all attributes except DW_FORM_addr ones, -1 if any is variable */
+    uint8_t addrCount = 0;      /* DW_FORM_addr attributes, their size comes from the unit header */
 };
 
 /* This will store the set of Dwarf abbrev contained in a specific abbrev offset */
-typedef struct
+typedef struct FileBin_DWARF_CompileUnitDataType
 {
-    uint32_t abbrevOffset;  // from .debug_info CU header
-    std::unordered_map<uint32_t, FileBin_DWARF_Abbrev> abbrevTable;
+    uint64_t abbrevOffset;  // from .debug_info CU header
+    uint8_t offsetSize;     /* Offset size of the units using it, fixed form sizes depend on it */
+    std::vector<FileBin_DWARF_Abbrev> abbrevTable; /* Indexed by abbrev code */
+    std::unordered_map<uint32_t, FileBin_DWARF_Abbrev> abbrevSparse; /* Codes above FILEBIN_DWARF_ABBREV_DENSE_MAX */
+
+    const FileBin_DWARF_Abbrev* Find(uint64_t code) const
+    {
+        if (code < abbrevTable.size())
+        {
+            const FileBin_DWARF_Abbrev& abbrev = abbrevTable[code];
+            return (abbrev.code != 0) ? &abbrev : nullptr;
+        }
+
+        auto it = abbrevSparse.find(static_cast<uint32_t>(code));
+        return (it != abbrevSparse.end()) ? &it->second : nullptr;
+    }
 } FileBin_DWARF_CompileUnitDataType;
 
-struct TreeElementType;
+/* Symbol node sizes live in the arena of the compilation unit owning the node */
+typedef std::vector<uint32_t, FileBin_ArenaAllocator<uint32_t>> FileBin_DWARF_SizeType;
+
+typedef enum
+{
+    FILEBIN_DWARF_ATTR_NONE,
+    FILEBIN_DWARF_ATTR_CONSTANT,   /* Value holds the integer (data, ref, addr, flag, udata, sdata) */
+    FILEBIN_DWARF_ATTR_STRING,     /* Data/Len point to the characters, without the terminator */
+    FILEBIN_DWARF_ATTR_BLOCK,      /* Data/Len point to the raw block or expression bytes */
+} FileBin_DWARF_AttrClassType;
+
+/* Decoded attribute value, strings and blocks are views into the mapped file */
+typedef struct FileBin_DWARF_AttrValueType
+{
+    FileBin_DWARF_AttrClassType Class = FILEBIN_DWARF_ATTR_NONE;
+    uint64_t Value = 0;
+    const uint8_t* Data = nullptr;
+    uint32_t Len = 0;
+
+    void SetConstant(uint64_t value)
+    {
+        Class = FILEBIN_DWARF_ATTR_CONSTANT;
+        Value = value;
+    }
+
+    void SetBlock(FileBin_DWARF_AttrClassType attrClass, const uint8_t* data, uint64_t len)
+    {
+        Class = attrClass;
+        Data = data;
+        Len = static_cast<uint32_t>(len);
+    }
+
+    std::string_view String(void) const
+    {
+        return (Class == FILEBIN_DWARF_ATTR_STRING) ? std::string_view(reinterpret_cast<const char*>(Data), Len) : std::string_view();
+    }
+} FileBin_DWARF_AttrValueType;
+
 struct TypeDefType;
+class FileBin_ELF;
 struct FileBin_VarInfoType;
 
 typedef struct FileBin_VarInfoType
 {
-    uint32_t Addr;
-    uint32_t TypeOffset; // to lookup hash
-    FileBin_DWARF_VarInfoLenType DataType;
+    uint64_t Addr = 0; /* Absolute for variables, relative to the parent node inside a type layout */
+    uint32_t TypeOffset = 0; // to lookup hash
+    FileBin_DWARF_VarInfoLenType DataType = FileBin_VARINFO_TYPE__UNKNOWN;
     struct FileBin_VarInfoType *next = nullptr;
     struct FileBin_VarInfoType *child = nullptr;
-    std::vector<uint8_t> data;
-    FileBin_DWARF_ElementType elementType;
-    bool isQualifier;
-    std::vector<uint32_t> Size;
+    uint32_t nameId = 0; /* Name in the string pool of the parser (FileBin_DWARF::GetName()), 0 if unnamed */
+    FileBin_DWARF_ElementType elementType = FILEBIN_DWARF_ELEMENT__UNKNOWN;
+    bool isQualifier = false;
+    FileBin_DWARF_SizeType Size;
+
+    FileBin_VarInfoType(FileBin_Arena* arena = nullptr) : Size(FileBin_ArenaAllocator<uint32_t>(arena)) {}
 } FileBin_DWARF_VarInfoType;
 
+/* Type DIE resolved once per unit, its nodes are shared read-only by every variable of that type */
+typedef struct FileBin_TypeLayoutType
+{
+    FileBin_DWARF_VarInfoType* Node = nullptr; /* Resolved subtree, linked as the child of each user */
+    FileBin_DWARF_VarInfoLenType DataType = FileBin_VARINFO_TYPE__UNKNOWN;
+    FileBin_DWARF_SizeType Size; /* Size handed to each user */
+    bool SizeAppend = false; /* Arrays and enumerations append to the user size instead of replacing it */
+    uint32_t SymbolSize = 0;
+
+    FileBin_TypeLayoutType(FileBin_Arena* arena = nullptr) : Size(FileBin_ArenaAllocator<uint32_t>(arena)) {}
+} FileBin_DWARF_TypeLayoutType;
+
+/* Sections a split unit reads from: its .dwo file, or its contributions to a .dwp package. Offsets are into Data */
+typedef struct FileBin_DWARF_SplitSectionsType
+{
+    const uint8_t* Data = nullptr;                      /* Mapped .dwo or .dwp file */
+    uint64_t AbbrevOffset = 0;                          /* .debug_abbrev.dwo */
+    uint64_t StrOffset = 0;                             /* .debug_str.dwo */
+    uint64_t StrOffsetsOffset = 0, StrOffsetsLen = 0;   /* .debug_str_offsets.dwo */
+} FileBin_DWARF_SplitSectionsType;
+
+/* Units of a split file to read, see FileBin_DWARF::OpenSplitUnits() */
 typedef struct
 {
-    uint32_t Length_Bytes;
+    struct FileBin_CompileUnitType* Skeleton = nullptr; /* Replaced by the split unit found there, nullptr for type units only */
+    const FileBin_DWARF_SplitSectionsType* Sections = nullptr;
+    uint64_t InfoOffset = 0, InfoLen = 0; /* Units in Sections->Data */
+    bool TypeSection = false; /* .debug_types.dwo */
+} FileBin_DWARF_SplitSourceType;
+
+typedef struct FileBin_CompileUnitType
+{
+    uint64_t Length_Bytes; /* unit_length, the unit_length field itself excluded */
     uint8_t Version;
-    uint32_t AbrevOffset;
-    uint32_t Offset;
+    uint64_t AbrevOffset;
+    uint64_t Offset; /* In .debug_info, .debug_types and split file units follow it as if appended. DIE offsets stay unit relative on 32 bits */
+    const uint8_t* Data = nullptr; /* Mapped file holding the unit, the parsed one or a .dwo / .dwp file */
+    uint64_t FileOffset = 0; /* Unit start in Data */
+    uint8_t OffsetSize = 4; /* Section offsets in the unit: 4 bytes in 32-bit DWARF, 8 in 64-bit DWARF */
     uint32_t AddrSize;
+    uint8_t HeaderSize_Byte; /* Unit header length, first DIE starts right after it */
     FileBin_DWARF_CompileUnitDataType* AbbrevInfo;
-    std::unordered_map<uint32_t, TreeElementType*> typeList; // <-- now TypeDefType is known
-    std::unordered_map<uint32_t, TreeElementType*> varDeclaration; // <-- now TypeDefType is known
+    std::unordered_map<uint32_t, uint32_t> typeList; /* Type DIE rows by DIE offset */
+    std::unordered_map<uint32_t, uint32_t> varList; /* Variable DIE rows without a location (declarations, abstract instances) by DIE offset */
+    std::unordered_map<uint32_t, uint64_t> typeRefs; /* Rows whose type DIE lives in another unit, its .debug_info offset */
+    std::unordered_map<uint32_t, uint64_t> originRefs; /* Rows completing a variable of another unit, its .debug_info offset */
+    std::unordered_map<uint64_t, FileBin_DWARF_TypeLayoutType*> typeLayout; /* Resolved types by .debug_info offset, other units included */
+    std::unordered_map<uint32_t, FileBin_DWARF_VarInfoType*> symbolIndex; /* Variables of the unit by name id */
     uint8_t UnitType; //DWARF5
+    uint64_t StrOffsetsBase = 0; /* DWARF5 DW_AT_str_offsets_base, first DW_FORM_strx* entry of the unit in .debug_str_offsets */
+    uint64_t AddrBase = 0; /* DWARF5 DW_AT_addr_base, first DW_FORM_addrx* entry of the unit in .debug_addr */
+    bool TypeUnit = false; /* DW_UT_type or .debug_types unit, holds types only and has no symbol node */
+    uint64_t TypeSignature = 0; /* Type units: signature DW_FORM_ref_sig8 references name them by */
+    uint64_t TypeDieOffset = 0; /* Type units: unit relative offset of the type DIE the signature stands for */
+    const FileBin_DWARF_SplitSectionsType* Split = nullptr; /* Units of a .dwo / .dwp file, nullptr in the parsed file */
+    bool Skeleton = false; /* Only points at its split unit (-gsplit-dwarf), which replaces it once found */
+    uint64_t DwoId = 0; /* Skeleton and split units: id pairing them, from the DWARF 5 header or DW_AT_GNU_dwo_id */
+    std::string DwoName; /* Skeleton units: .dwo file holding the split unit, relative to CompDir */
+    std::string CompDir; /* Skeleton units: build directory */
+    FileBin_Arena Arena; /* Owns every DIE and symbol node of the unit, freed with it */
+    std::vector<std::unique_ptr<FileBin_Arena>> RangeArenas; /* Symbol nodes of the ranges resolved by separate workers */
+    FileBin_DIEStore Dies; /* Decoded DIEs, row 0 is the tree root holding the unit DIE as its child */
+    struct FileBin_CompileUnitType* NextUnit = nullptr; /* Unit whose root follows this one */
+    FileBin_DWARF_VarInfoType* Symbols = nullptr; /* Symbol node of the unit, variables hang below it */
+    bool SymbolsLoaded = false; /* Lazy mode: variables of the unit not resolved yet */
+    bool Reused = false; /* Taken over from the previous parse by FileBin_DWARF::Reload(), nothing to decode */
+    bool Indexed = false; /* Types and variables of the unit are in the DIE index of FileBin_DWARF */
+
+    uint64_t Size(void) const { return Length_Bytes + ((OffsetSize == 8) ? 12 : 4); } /* Whole unit in .debug_info */
 } FileBin_DWARF_CompileUnitType;
 
-typedef struct TreeElementType
+/* Row of a unit DIE store, cheap to copy and valid until the next Parse(). Root rows chain across units */
+typedef struct FileBin_DWARF_DieCursor
 {
-    struct TreeElementType *next = nullptr;
-    struct TreeElementType *child = nullptr;
-    std::vector<uint8_t> data;
-    FileBin_DWARF_ElementType elementType;
-    uint32_t typeOffset;
-    FileBin_DWARF_CompileUnitType *cu = nullptr;
-    uint32_t Addr;
-    std::vector<uint32_t> Size; /* Size of the element in memory (in bytes) */
-    uint32_t Location;
-    bool isDeclaration; //is just a forward declaration, not the actual definition
-    //struct TreeElementType* specification = nullptr; // points to declaration if this is a definition
-} TreeElementType;
+    FileBin_DWARF_CompileUnitType* Unit = nullptr;
+    uint32_t Row = FILEBIN_DIESTORE_NONE;
+
+    FileBin_DWARF_DieCursor(FileBin_DWARF_CompileUnitType* unit = nullptr, uint32_t row = FILEBIN_DIESTORE_NONE) : Unit(unit), Row(row) {}
+
+    bool Valid(void) const { return (Unit != nullptr) && (Row != FILEBIN_DIESTORE_NONE); }
 
+    FileBin_DWARF_ElementType Tag(void) const { return static_cast<FileBin_DWARF_ElementType>(Unit->Dies.Tag[Row]); }
+    uint32_t NameId(void) const { return Unit->Dies.NameId[Row]; }
+    uint32_t TypeOffset(void) const { return Unit->Dies.TypeOffset[Row]; }
+    uint64_t Addr(void) const { return Unit->Dies.Addr[Row]; }
+    uint32_t Location(void) const { return Unit->Dies.Location[Row]; }
+    uint8_t Encoding(void) const { return Unit->Dies.Encoding[Row]; }
+    bool IsDeclaration(void) const { return (Unit->Dies.Flags[Row] & FILEBIN_DIESTORE_FLAG_DECLARATION) != 0; }
+    bool IsTypeRef(void) const { return (Unit->Dies.Flags[Row] & FILEBIN_DIESTORE_FLAG_TYPE_REF) != 0; }
+    bool IsOriginRef(void) const { return (Unit->Dies.Flags[Row] & FILEBIN_DIESTORE_FLAG_ORIGIN_REF) != 0; }
+    uint32_t DimCount(void) const { return Unit->Dies.DimCount[Row]; }
+    uint32_t Dim(uint32_t idx) const { return Unit->Dies.GetDim(Row, idx); }
+
+    /* Children decoded so far, lazy mode children come from FileBin_DWARF::GetChildren() */
+    bool HasChildren(void) const { return (Unit->Dies.FirstChild[Row] != FILEBIN_DIESTORE_NONE) || Unit->Dies.IsPending(Row); }
+    FileBin_DWARF_DieCursor Child(void) const { return FileBin_DWARF_DieCursor(Unit, Unit->Dies.FirstChild[Row]); }
+    FileBin_DWARF_DieCursor Parent(void) const { return FileBin_DWARF_DieCursor(Unit, Unit->Dies.Parent[Row]); }
+    FileBin_DWARF_DieCursor Next(void) const
+    {
+        return (Row == 0) ? FileBin_DWARF_DieCursor(Unit->NextUnit, Unit->NextUnit ? 0 : FILEBIN_DIESTORE_NONE)
+                          : FileBin_DWARF_DieCursor(Unit, Unit->Dies.Sibling[Row]);
+    }
+} FileBin_DWARF_DieCursor;
+
+/* Where a symbol traversal allocates and caches: the unit itself, or one range of its top-level DIEs */
+typedef struct
+{
+    FileBin_DWARF_CompileUnitType* Unit = nullptr;
+    FileBin_Arena* Arena = nullptr;
+    std::unordered_map<uint64_t, FileBin_DWARF_TypeLayoutType*>* TypeLayout = nullptr;
+    std::unordered_map<uint32_t, FileBin_DWARF_VarInfoType*>* SymbolIndex = nullptr;
+} FileBin_DWARF_SymbolScopeType;
+
+/* Top-level DIEs of a large unit resolved as one task, merged into the unit in document order afterwards */
+typedef struct
+{
+    uint32_t UnitIdx = 0;
+    FileBin_DWARF_DieCursor First, End; /* [First, End), End invalid for the last range */
+    uint32_t Weight = 0; /* Share of the unit weight, by DIE rows */
+    FileBin_Arena* Arena = nullptr; /* One of the unit RangeArenas */
+    FileBin_DWARF_VarInfoType Symbols; /* Placeholder, the variables of the range are its children */
+    std::unordered_map<uint64_t, FileBin_DWARF_TypeLayoutType*> TypeLayout;
+    std::unordered_map<uint32_t, FileBin_DWARF_VarInfoType*> SymbolIndex;
+} FileBin_DWARF_SymbolRangeType;
+
+/* Memory location a symbol path resolves to */
+typedef struct
+{
+    FileBin_DWARF_VarInfoType* Node = nullptr; /* Variable or member the path ends on */
+    uint64_t Addr = 0;                         /* Absolute address */
+    FileBin_DWARF_VarInfoLenType DataType = FileBin_VARINFO_TYPE__UNKNOWN;
+    uint32_t Size = 0;                         /* Bytes at Addr, whole remaining array if not fully indexed */
+} FileBin_DWARF_SymbolRefType;
+
+/* Task indices of one ParallelFor worker, the owner pops the front and idle workers steal from the back */
+typedef struct
+{
+    std::mutex Lock;
+    std::deque<uint32_t> Tasks;
+} FileBin_DWARF_WorkQueueType;
+
+
+/* Sections besides .debug_info and .debug_str, as file offset and size (0 size when absent). See FileBin_DWARF::SetSections() */
+typedef struct FileBin_DWARF_SectionsType
+{
+    uint64_t LineStrOffset = 0, LineStrLen = 0;         /* .debug_line_str, DW_FORM_line_strp */
+    uint64_t StrOffsetsOffset = 0, StrOffsetsLen = 0;   /* .debug_str_offsets, DW_FORM_strx* */
+    uint64_t AddrOffset = 0, AddrLen = 0;               /* .debug_addr, DW_FORM_addrx* and DW_OP_addrx */
+    uint64_t TypesOffset = 0, TypesLen = 0;             /* .debug_types, DWARF 4 type units */
+} FileBin_DWARF_SectionsType;
 
 class FileBin_DWARF
 {
     private:
 
-        std::unordered_map<uint32_t, FileBin_DWARF_CompileUnitDataType> AbbrevOffsetCache;
+        std::unordered_map<uint64_t, FileBin_DWARF_CompileUnitDataType> AbbrevOffsetCache; /* By file offset and offset size */
+        std::mutex AbbrevOffsetCacheMutex; /* Units are parsed concurrently, entries never move once inserted */
         std::vector<FileBin_DWARF_CompileUnitType*> CompilationUnit; /* Array of Compilation Units (DWARF top-most level DIE) extracted from abbrev */
         const uint8_t* fileBase;
+        MappedFile File; /* Kept mapped while the trees exist, names point into it */
+        uint64_t InfoLen = 0; /* Size of .debug_info in File */
+        FileBin_ByteOrder ByteOrder = FILEBIN_BYTEORDER_LITTLE;
+        bool Lazy = false; /* Decode DIEs below the unit DIE only when first asked for */
+        std::unordered_map<std::string_view, FileBin_DWARF_CompileUnitType*> UnitIndex; /* By unit path and file name */
+        std::unordered_map<uint32_t, FileBin_DWARF_VarInfoType*> SymbolIndex; /* Unqualified variable names by id */
+        bool SymbolIndexComplete = false; /* Lazy mode: built on the first unqualified lookup */
+        FileBin_StringPool Names; /* Every DIE and symbol name, nodes only hold the id */
+        uint32_t ConstLabelId = 0; /* Names of the qualifier and type nodes, see InternLabels() */
+        uint32_t VolatileLabelId = 0;
+        uint32_t PointerLabelId = 0;
+        uint32_t StructLabelId = 0;
+        uint32_t EnumLabelId = 0;
+        uint32_t ArrayLabelId = 0;
+        uint32_t DimLabelId = 0;
+        std::string CacheDir; /* Symbol database directory, empty when caching is off */
+        uint64_t CacheKey = 0; /* Content key of the file the next Parse() reads */
+        MappedFile CacheFile; /* Database a Parse() was served from, names and DIE columns point into it */
+        FileBin_DWARF_SectionsType Sections; /* Other DWARF sections of the file the next Parse() reads */
+        FileBin_SearchIndex SymbolSearch; /* Unit paths and variable names */
+        FileBin_SearchIndex DIESearch; /* Names of all decoded DIEs, items point into DIESearchRefs */
+        std::deque<FileBin_DWARF_DieCursor> DIESearchRefs; /* Stable storage for the cursors DIESearch hands out */
+        std::unordered_multimap<uint32_t, FileBin_DWARF_CompileUnitType*> ReloadUnits; /* Reload(): resolved units of the previous parse by name id */
+        std::mutex ReloadUnitsMutex; /* Units claim their predecessor concurrently */
+        FileBin_DIEIndex DieIndex; /* Types and variables of all units, built once a unit references another */
+        std::unordered_map<uint64_t, FileBin_DWARF_CompileUnitType*> TypeUnits; /* By type signature */
+        std::string FileName; /* File of the last Parse(), .dwo and .dwp files are also looked up next to it */
+        std::vector<std::unique_ptr<FileBin_ELF>> SplitFiles; /* .dwo / .dwp files split units were read from, mapped like File */
+        std::deque<FileBin_DWARF_SplitSectionsType> SplitSections; /* Stable storage for FileBin_DWARF_CompileUnitType::Split */
+        uint32_t SplitMissing = 0; /* Skeleton units left without their split unit, such a parse is not cached */
 
         inline uint64_t FileBin_DWARF_ReadULEB128(const uint8_t*& ptr);
         inline int64_t FileBin_DWARF_ReadSLEB128(const uint8_t*& ptr);
 
 
         void Reset();
-        void DeleteTree(TreeElementType* node);
-        void FreeTree(TreeElementType* node);
-        void FreeSymTree(FileBin_DWARF_VarInfoType* node);
+        void ResetIndexes(void);
+        void InternLabels(void);
+        void DropReloadUnits(void);
+        static FileBin_DWARF_VarInfoType* NewVarInfo(FileBin_DWARF_CompileUnitType* cu);
+        static FileBin_DWARF_VarInfoType* NewVarInfo(FileBin_Arena* arena);
+        static uint32_t ParallelFor(const char* phase, const std::vector<uint32_t>& weights, const std::function<void(uint32_t)>& fn);
+
+        template <FileBin_ByteOrder Order>
+        void ExpandDIE(FileBin_DWARF_DieCursor node, bool lazy);
+        template <FileBin_ByteOrder Order>
+        void MaterializeTree(FileBin_DWARF_DieCursor node);
+        void IndexUnit(uint32_t idx);
+        FileBin_DWARF_DieCursor FindDIE(uint64_t offset);
+        void UnitSymbolTraverse(FileBin_DWARF_CompileUnitType* cu);
+        uint32_t SplitSymbolRanges(uint32_t unitIdx, uint64_t rangeWeight, std::deque<FileBin_DWARF_SymbolRangeType>& ranges);
+        void MergeSymbolRanges(std::deque<FileBin_DWARF_SymbolRangeType>& ranges);
+        void BuildSymbolIndex(void);
+        void SearchIndexUnit(FileBin_DWARF_CompileUnitType* cu);
+        void SearchIndexDIE(FileBin_DWARF_DieCursor node);
+        std::string CachePath(void) const;
+        uint8_t LoadCache(void);
+        uint8_t SaveCache(void);
+        uint32_t ParseAndResolve(uint64_t AbbrevOffset, uint64_t InfoLen);
+        uint8_t ParseFile(std::string file_name, uint64_t Offset, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset,
+                          FileBin_ByteOrder ByteOrder, bool reload);
+        static uint64_t UnitFingerprint(const FileBin_DWARF_CompileUnitType* cu);
+        template <FileBin_ByteOrder Order>
+        void ReuseUnit(uint32_t idx);
+        template <FileBin_ByteOrder Order>
+        void ReadUnitBases(FileBin_DWARF_CompileUnitType* cu, const uint8_t* ptr);
+        template <FileBin_ByteOrder Order>
+        const uint8_t* IndexedString(const FileBin_DWARF_CompileUnitType* cu, uint64_t index) const;
+        template <FileBin_ByteOrder Order>
+        uint64_t IndexedAddr(const FileBin_DWARF_CompileUnitType* cu, uint64_t index) const;
+
+        template <FileBin_ByteOrder Order>
+        void ParseUnits(const uint8_t* fileData, uint64_t AbbrevOffset, uint64_t InfoOffset, uint64_t InfoLen);
+
+        /* -gsplit-dwarf: split units of the skeleton units from a .dwp package next to the file, or else from
+         * the .dwo file each skeleton names, see FileBin_DWARF_Split.cpp */
+        template <FileBin_ByteOrder Order>
+        void ParseSplitUnits(const std::function<void(uint32_t)>& parseUnit);
+        void OpenSplitUnits(std::vector<FileBin_DWARF_SplitSourceType>& sources);
+        bool OpenSplitPackage(const std::string& path, const std::vector<FileBin_DWARF_CompileUnitType*>& skeletons,
+                              std::vector<FileBin_DWARF_SplitSourceType>& sources);
+        FileBin_DWARF_SplitSectionsType* AddSplitSections(const FileBin_ELF& file);
 
     public:
 
         FileBin_DWARF_VarInfoType* SymbolRoot;
-        uint32_t InfoOffset;
-        uint32_t StrOffset;
-        TreeElementType *DataRoot; /* data extracred from .debug_info thanks to CompilationUnit */
-        uint8_t HeaderSize_Byte;
+        uint64_t InfoOffset;
+        uint64_t StrOffset;
+        FileBin_DWARF_DieCursor DataRoot; /* Root row of the first unit, data extracted from .debug_info */
 
         FileBin_DWARF(void);
+        ~FileBin_DWARF();
+
+        /* Skeleton units of -gsplit-dwarf builds are replaced by their split units, read from "file.dwp" when
+         * present or else from the .dwo files they name (build directory, then next to the file) */
+        uint8_t Parse(std::string file_name, uint64_t Offset, uint64_t Len, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset,
+                      FileBin_ByteOrder ByteOrder = FILEBIN_BYTEORDER_LITTLE);
+
+        /* Parse() of a rebuilt file: resolved units of the previous parse whose decoded DIEs come out the same
+         * are taken over with their DIE store and symbol nodes, so cursors and nodes into them stay valid.
+         * Only the other units are resolved again. Names outlive the previous file, each Reload() adds the
+         * new ones to the pool until the next Parse() */
+        uint8_t Reload(std::string file_name, uint64_t Offset, uint64_t Len, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset,
+                       FileBin_ByteOrder ByteOrder = FILEBIN_BYTEORDER_LITTLE);
+
+        /* Lazy mode (applies to the next Parse): only unit headers and unit DIEs are decoded up front,
+         * DIE children and unit variables are decoded on first request through the getters below */
+        void SetLazy(bool Lazy);
+        bool IsLazy(void) const;
+
+        /* Symbol database (applies to the next Parse): the resolved DIE and symbol trees are stored in
+         * CacheDir under the content key of the file (FileBin_ELF::GetContentKey()) and read back instead
+         * of parsing when the same file is opened again. Without a database the Parse() is a full one, also
+         * in lazy mode, and writes it. An empty CacheDir turns caching off */
+        void SetCache(std::string CacheDir, uint64_t Key);
+
+        /* DWARF 5 string and address sections and DWARF 4 type units (applies to the next Parse), indexed forms
+         * read straight from the mapped file through the unit bases. Files without them only need .debug_str */
+        void SetSections(const FileBin_DWARF_SectionsType& Sections);
+        FileBin_DWARF_DieCursor GetChildren(FileBin_DWARF_DieCursor node);
+        FileBin_DWARF_VarInfoType* GetUnitSymbols(FileBin_DWARF_VarInfoType* unitSymbol);
+        std::string_view GetName(uint32_t nameId) const; /* Name of a node, valid until the next Parse() */
+
+        /* Name lookup, "symbol" or "unit:symbol" where unit is the unit path or its file name. Paths add
+         * members and indices, e.g. "CalParams.gain[3].x". Valid until the next Parse() */
+        FileBin_DWARF_VarInfoType* FindSymbol(std::string_view name);
+        uint8_t ResolvePath(std::string_view path, FileBin_DWARF_SymbolRefType& ref);
 
-        uint8_t Parse(std::string file_name, uint32_t Offset, uint32_t Len, uint32_t InfoOffset, uint32_t InfoLen, uint32_t StrOffset);
+        /* Case-insensitive substring search, unit symbols (compile unit nodes) and variables, or DIEs */
+        std::vector<FileBin_DWARF_VarInfoType*> SearchSymbols(std::string_view query, uint32_t maxResults = 1000);
+        std::vector<FileBin_DWARF_DieCursor> SearchDIEs(std::string_view query, uint32_t maxResults = 1000);
 
-        void ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint32_t AbbrevOffset, uint32_t InfoOffset, uint32_t InfoLen);
-        FileBin_DWARF_CompileUnitDataType* ParseAbbrevOffset(const uint8_t* abbrevPtr);
-        TreeElementType* ParseDIE(const uint8_t*& ptr, const uint8_t* fileBase, uint32_t cuOffset, uint32_t infoLen, FileBin_DWARF_CompileUnitType* cu,TreeElementType* parent);
-        std::vector<uint8_t> ReadAttributeValue(const uint8_t*& ptr, uint32_t form, uint8_t addrSize, const uint8_t* fileBase);
+        template <FileBin_ByteOrder Order>
+        void ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint64_t AbbrevOffset, uint64_t InfoOffset, uint64_t InfoLen, bool TypeSection = false,
+                                        const FileBin_DWARF_SplitSectionsType* Split = nullptr);
+        FileBin_DWARF_CompileUnitDataType* ParseAbbrevOffset(const uint8_t* abbrevPtr, uint8_t offsetSize);
+        template <FileBin_ByteOrder Order>
+        uint32_t ParseDIE(const uint8_t*& ptr, const uint8_t* fileBase, uint64_t cuOffset, uint64_t cuSize, FileBin_DWARF_CompileUnitType* cu, uint32_t parent, bool lazy);
+        template <FileBin_ByteOrder Order>
+        void SkipAttributeValue(const uint8_t*& ptr, const FileBin_DWARF_AbbrevAttr& attrForm, const FileBin_DWARF_CompileUnitType* cu);
+        template <FileBin_ByteOrder Order>
+        void SkipDIE(const uint8_t*& ptr, const uint8_t* sectionEnd, FileBin_DWARF_CompileUnitType* cu);
+        static void CompileAbbrev(FileBin_DWARF_Abbrev& abbrev, uint8_t offsetSize);
+        static int8_t FormFixedSize(uint64_t form, uint8_t offsetSize);
+        template <FileBin_ByteOrder Order>
+        FileBin_DWARF_AttrValueType ReadAttributeValue(const uint8_t*& ptr, const FileBin_DWARF_AbbrevAttr& attrForm, const FileBin_DWARF_CompileUnitType* cu);
 
-        uint8_t SymbolResolveType(TreeElementType* node, FileBin_DWARF_VarInfoType* parent);
-        void SymbolTraverse(TreeElementType* node, FileBin_DWARF_VarInfoType *parent);
+        /* Nodes are allocated in the scope resolving the symbols, the type DIE may be of another unit */
+        uint32_t SymbolResolveType(FileBin_DWARF_SymbolScopeType& scope, FileBin_DWARF_DieCursor node, FileBin_DWARF_VarInfoType* parent);
+        const FileBin_DWARF_TypeLayoutType* SymbolAttachType(FileBin_DWARF_SymbolScopeType& scope, uint64_t typeOffset, FileBin_DWARF_VarInfoType* parent);
+        void SymbolTraverse(FileBin_DWARF_SymbolScopeType& scope, FileBin_DWARF_DieCursor node, FileBin_DWARF_DieCursor end, FileBin_DWARF_VarInfoType* parent);
 
         void PrintAllAbbrevInfo() const;
         static std::string FileBin_DWARF_DW_AT_ToString(uint16_t StrCode);
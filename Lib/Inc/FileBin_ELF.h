@@ -38,8 +38,12 @@ extern "C" {
 }
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <cstdint>  // for uint32_t, uint16_t, etc.
-#include <cstdio>   // for FILE*
+#include "FileBin_MappedFile.h"
+#include "FileBin_Endian.h"
+#include "FileBin_Hash.h"
 
 typedef struct
 {
@@ -47,9 +51,46 @@ typedef struct
 } SectionInfoType;
 
 struct SectionMapEntry {
-    uint32_t vaStart;    // section virtual address
-    uint32_t vaEnd;      // vaStart + sh_size
-    uint32_t fileOffset; // sh_offset in ELF file
+    uint64_t vaStart;    // section virtual address
+    uint64_t vaEnd;      // vaStart + sh_size
+    uint64_t fileOffset; // sh_offset in ELF file
+    uint64_t fileSize;   // bytes backed by the file (0 for SHT_NOBITS)
+};
+
+struct SymbolReadRequest {
+    uint64_t va;         // symbol virtual address
+    uint32_t size;       // bytes to read
+    const uint8_t* data; // view into the mapped ELF, nullptr if not file backed
+};
+
+/* Entry of .symtab, Name points into the mapped string table (valid until the next Parse) */
+struct FileBin_ELF_SymbolType {
+    std::string_view Name;
+    uint64_t Addr;       // st_value
+    uint64_t Size;       // st_size
+    uint8_t Type;        // STT_*
+    uint8_t Bind;        // STB_*
+    uint16_t SectionIdx; // st_shndx
+};
+
+/* Compile time ELF class traits, the parser is instantiated once per class so the
+ * section loop has no per-field 32/64-bit branching */
+struct FileBin_ELF_Class32
+{
+    typedef Elf32_Ehdr Ehdr;
+    typedef Elf32_Shdr Shdr;
+    typedef Elf32_Phdr Phdr;
+    typedef Elf32_Sym  Sym;
+    static constexpr unsigned char Class = ELFCLASS32;
+};
+
+struct FileBin_ELF_Class64
+{
+    typedef Elf64_Ehdr Ehdr;
+    typedef Elf64_Shdr Shdr;
+    typedef Elf64_Phdr Phdr;
+    typedef Elf64_Sym  Sym;
+    static constexpr unsigned char Class = ELFCLASS64;
 };
 
 class FileBin_ELF
@@ -57,41 +98,83 @@ class FileBin_ELF
 
     private:
 
-        FILE* file_descriptor = nullptr;
+        MappedFile File;    /* Kept mapped after Parse() so symbol reads are plain pointer arithmetic */
         std::string File_Name;
-        Elf32_Ehdr elf_header;
+        FileBin_ByteOrder ByteOrder = FILEBIN_BYTEORDER_LITTLE; /* Target data encoding from e_ident[EI_DATA] */
+        Elf64_Ehdr elf_header;              /* Normalized to the 64-bit layout whatever the file class */
+        std::vector<Elf64_Shdr> SectionHeader; /* Normalized section headers, indexed as in the file */
         bool debugInfoAbbrevFound = false;
         bool debugInfoInfoFound = false;
         bool debugInfoStrFound = false;
-        uint32_t AbbrevOffset = 0, AbbrevLen = 0, InfoOffset = 0, StrOffset = 0, InfoLen = 0;
+        uint64_t AbbrevOffset = 0, AbbrevLen = 0, InfoOffset = 0, StrOffset = 0, InfoLen = 0;
+        uint64_t LineStrOffset = 0, LineStrLen = 0;         /* DWARF 5 sections, 0 length if absent */
+        uint64_t StrOffsetsOffset = 0, StrOffsetsLen = 0;
+        uint64_t AddrOffset = 0, AddrLen = 0;
+        uint64_t TypesOffset = 0, TypesLen = 0;             /* DWARF 4 type units */
+        uint64_t CuIndexOffset = 0, CuIndexLen = 0;         /* DWARF packages (.dwp), split units by id */
+        uint64_t TuIndexOffset = 0, TuIndexLen = 0;
         std::vector<SectionInfoType> SectionNameStr;
-        Elf32_Shdr string_section;
-        const Elf32_Shdr *symbol_section_header, *symbol_string_section_header;
+        uint32_t SymbolSectionIdx = 0, SymbolStringSectionIdx = 0;
         std::vector<SectionMapEntry> sectionMap;
+        std::vector<FileBin_ELF_SymbolType> Symbol;                  /* .symtab sorted by address */
+        std::unordered_map<std::string_view, uint32_t> SymbolByName; /* Name to index in Symbol */
+        std::vector<uint64_t> SymbolEndMax;                          /* Highest Addr + Size of Symbol[0..i] */
+        uint64_t BuildIdOffset = 0, BuildIdLen = 0; /* Descriptor of the NT_GNU_BUILD_ID note, 0 length if absent */
+
+        template <typename ElfClass, FileBin_ByteOrder Order>
+        uint8_t ParseClass(void);
+        uint8_t ParseSections(void);
+        template <typename ElfClass, FileBin_ByteOrder Order>
+        void ParseSymbols(void);
 
     public:
 
-        std::vector<SectionMapEntry> buildSectionMap(const std::vector<Elf32_Shdr>& section_headers);
-        const SectionMapEntry* findSectionForVA( uint32_t va);
+        std::vector<SectionMapEntry> buildSectionMap(const std::vector<Elf64_Shdr>& section_headers);
+        const SectionMapEntry* findSectionForVA(uint64_t va) const;
 
-        std::vector<uint8_t> readSymbolFromELF(uint32_t symbolVA,
-                                               uint32_t symbolSize);
+        const uint8_t* readSymbolView(uint64_t symbolVA, uint32_t symbolSize) const;
+        std::vector<uint8_t> readSymbolFromELF(uint64_t symbolVA,
+                                               uint32_t symbolSize) const;
+        void readSymbolsFromELF(std::vector<SymbolReadRequest>& requests) const;
+        const std::vector<FileBin_ELF_SymbolType>& GetSymbols(void) const;
+        const FileBin_ELF_SymbolType* FindSymbolByName(std::string_view name) const;
+        const FileBin_ELF_SymbolType* FindSymbolByAddr(uint64_t addr) const;
         FileBin_ELF(void);
         uint8_t Parse(const std::string& file_name);
-        std::string GetStr_ElfClass(const Elf32_Ehdr* elf_header) const;
-        std::string GetStr_ElfDataEncoding(const Elf32_Ehdr* elf_header) const;
-        std::string GetStr_ElfOSABI(const Elf32_Ehdr* elf_header) const;
-        std::string GetStr_ElfType(const Elf32_Ehdr* elf_header) const;
-        std::string GetStr_ElfMachine(const Elf32_Ehdr* elf_header) const;
-        std::string GetStr_SectionHeader(const Elf32_Shdr* section_header) const;
+        std::string GetStr_ElfClass(const Elf64_Ehdr* elf_header) const;
+        std::string GetStr_ElfDataEncoding(const Elf64_Ehdr* elf_header) const;
+        std::string GetStr_ElfOSABI(const Elf64_Ehdr* elf_header) const;
+        std::string GetStr_ElfType(const Elf64_Ehdr* elf_header) const;
+        std::string GetStr_ElfMachine(const Elf64_Ehdr* elf_header) const;
+        std::string GetStr_SectionHeader(const Elf64_Shdr* section_header) const;
+        bool Is64Bit(void) const;
+        FileBin_ByteOrder GetByteOrder(void) const;
         bool IsDWARF(void) const;
-        uint32_t GetAbbrevOffset(void) const;
-        uint32_t GetAbbrevLen(void) const;
-        uint32_t GetInfoOffset(void) const;
-        uint32_t GetInfoLen(void) const;
-        uint32_t GetStrOffset(void) const;
+        uint64_t GetAbbrevOffset(void) const;
+        uint64_t GetAbbrevLen(void) const;
+        uint64_t GetInfoOffset(void) const;
+        uint64_t GetInfoLen(void) const;
+        uint64_t GetStrOffset(void) const;
+        uint64_t GetLineStrOffset(void) const;
+        uint64_t GetLineStrLen(void) const;
+        uint64_t GetStrOffsetsOffset(void) const;
+        uint64_t GetStrOffsetsLen(void) const;
+        uint64_t GetAddrOffset(void) const;
+        uint64_t GetAddrLen(void) const;
+        uint64_t GetTypesOffset(void) const;
+        uint64_t GetTypesLen(void) const;
+        uint64_t GetCuIndexOffset(void) const;
+        uint64_t GetCuIndexLen(void) const;
+        uint64_t GetTuIndexOffset(void) const;
+        uint64_t GetTuIndexLen(void) const;
+        /* Mapped file the offsets above are into, valid until the next Parse() */
+        const MappedFile& GetFile(void) const;
+        /* Every section of that name, a .dwo file holds a .debug_info.dwo or .debug_types.dwo per type unit group */
+        std::vector<const Elf64_Shdr*> GetSections(std::string_view name) const;
         uint32_t GetRODataOffset(void) const;
-        void PrintElfHeader(const Elf32_Ehdr* elf_header) const;
+        /* Identifies the file contents: hash of the GNU build-id when present, of the whole file otherwise */
+        uint64_t GetContentKey(void) const;
+        void PrintElfHeader(const Elf64_Ehdr* elf_header) const;
 
         void Print(void) const;
 };
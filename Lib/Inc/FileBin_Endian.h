@@ -0,0 +1,170 @@
+/**
+ *  \file       FileBin_Endian.h
+ *  \brief      Target byte order aware integer loads and stores
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+#ifndef FILEBIN_ENDIAN_H
+#define FILEBIN_ENDIAN_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+typedef enum
+{
+    FILEBIN_BYTEORDER_LITTLE = 0,
+    FILEBIN_BYTEORDER_BIG,
+} FileBin_ByteOrder;
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FILEBIN_BYTEORDER_HOST FILEBIN_BYTEORDER_BIG
+#else
+#define FILEBIN_BYTEORDER_HOST FILEBIN_BYTEORDER_LITTLE
+#endif
+
+static inline uint16_t FileBin_ByteSwap16(uint16_t v)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ushort(v);
+#else
+    return __builtin_bswap16(v);
+#endif
+}
+
+static inline uint32_t FileBin_ByteSwap32(uint32_t v)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ulong(v);
+#else
+    return __builtin_bswap32(v);
+#endif
+}
+
+static inline uint64_t FileBin_ByteSwap64(uint64_t v)
+{
+#if defined(_MSC_VER)
+    return _byteswap_uint64(v);
+#else
+    return __builtin_bswap64(v);
+#endif
+}
+
+/* Byte order policy. The order of the data is fixed at compile time so each access is an
+ * unaligned load plus (at most) a single bswap, without per-byte shifting or branching */
+template <FileBin_ByteOrder Order>
+struct FileBin_Endian
+{
+    static constexpr bool Swap = (Order != FILEBIN_BYTEORDER_HOST);
+
+    /* Converts an integer between target and host order (the operation is its own inverse) */
+    template <typename T>
+    static inline T Native(T v)
+    {
+        static_assert(std::is_integral<T>::value, "FileBin_Endian works on integers");
+
+        if constexpr (!Swap || (sizeof(T) == 1))
+        {
+            return v;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return static_cast<T>(FileBin_ByteSwap16(static_cast<uint16_t>(v)));
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return static_cast<T>(FileBin_ByteSwap32(static_cast<uint32_t>(v)));
+        }
+        else
+        {
+            return static_cast<T>(FileBin_ByteSwap64(static_cast<uint64_t>(v)));
+        }
+    }
+
+    template <typename T>
+    static inline T Load(const uint8_t* p)
+    {
+        T v;
+        std::memcpy(&v, p, sizeof(T));
+        return Native(v);
+    }
+
+    template <typename T>
+    static inline void Store(uint8_t* p, T v)
+    {
+        v = Native(v);
+        std::memcpy(p, &v, sizeof(T));
+    }
+
+    static inline uint16_t Load16(const uint8_t* p) { return Load<uint16_t>(p); }
+    static inline uint32_t Load32(const uint8_t* p) { return Load<uint32_t>(p); }
+    static inline uint64_t Load64(const uint8_t* p) { return Load<uint64_t>(p); }
+
+    /* Odd sized field (DWARF 5 strx3/addrx3), assembled from its bytes */
+    static inline uint32_t Load24(const uint8_t* p)
+    {
+        if constexpr (Order == FILEBIN_BYTEORDER_BIG)
+        {
+            return (static_cast<uint32_t>(p[0]) << 16) | (static_cast<uint32_t>(p[1]) << 8) | p[2];
+        }
+        else
+        {
+            return p[0] | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16);
+        }
+    }
+};
+
+/* Run time order selection for callers that only know the order after loading a file.
+ * The branch is taken once per value, never per byte */
+template <typename T>
+static inline T FileBin_Endian_Load(const uint8_t* p, FileBin_ByteOrder order)
+{
+    return (order == FILEBIN_BYTEORDER_BIG) ? FileBin_Endian<FILEBIN_BYTEORDER_BIG>::Load<T>(p)
+                                            : FileBin_Endian<FILEBIN_BYTEORDER_LITTLE>::Load<T>(p);
+}
+
+template <typename T>
+static inline void FileBin_Endian_Store(uint8_t* p, T v, FileBin_ByteOrder order)
+{
+    if (order == FILEBIN_BYTEORDER_BIG)
+    {
+        FileBin_Endian<FILEBIN_BYTEORDER_BIG>::Store<T>(p, v);
+    }
+    else
+    {
+        FileBin_Endian<FILEBIN_BYTEORDER_LITTLE>::Store<T>(p, v);
+    }
+}
+
+#endif // FILEBIN_ENDIAN_H
@@ -0,0 +1,110 @@
+/**
+ *  \file       FileBin_Hash.h
+ *  \brief      Fast 64-bit content hash
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#ifndef FILEBIN_HASH_H
+#define FILEBIN_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include "FileBin_Endian.h"
+
+/* Non-cryptographic hash to tell file contents apart (cache keys, unit fingerprints). Four independent
+ * 64-bit lanes consume 32 bytes per step so the multiplies overlap; words are read little endian so a
+ * given input hashes the same on every host */
+#define FILEBIN_HASH_PRIME1     0x9E3779B185EBCA87ull
+#define FILEBIN_HASH_PRIME2     0xC2B2AE3D27D4EB4Full
+#define FILEBIN_HASH_PRIME3     0x165667B19E3779F9ull
+
+static inline uint64_t FileBin_Hash_Rotl(uint64_t v, uint32_t r)
+{
+    return (v << r) | (v >> (64 - r));
+}
+
+static inline uint64_t FileBin_Hash_Round(uint64_t acc, uint64_t word)
+{
+    return FileBin_Hash_Rotl(acc + word * FILEBIN_HASH_PRIME2, 31) * FILEBIN_HASH_PRIME1;
+}
+
+static inline uint64_t FileBin_Hash64(const uint8_t* data, size_t len, uint64_t seed = 0)
+{
+    typedef FileBin_Endian<FILEBIN_BYTEORDER_LITTLE> E;
+    const uint8_t* end = data + len;
+    uint64_t h;
+
+    if (len >= 32)
+    {
+        uint64_t lane[4] = { seed + FILEBIN_HASH_PRIME1 + FILEBIN_HASH_PRIME2, seed + FILEBIN_HASH_PRIME2, seed, seed - FILEBIN_HASH_PRIME1 };
+
+        for (; data + 32 <= end; data += 32)
+        {
+            lane[0] = FileBin_Hash_Round(lane[0], E::Load64(data));
+            lane[1] = FileBin_Hash_Round(lane[1], E::Load64(data + 8));
+            lane[2] = FileBin_Hash_Round(lane[2], E::Load64(data + 16));
+            lane[3] = FileBin_Hash_Round(lane[3], E::Load64(data + 24));
+        }
+
+        h = FileBin_Hash_Rotl(lane[0], 1) + FileBin_Hash_Rotl(lane[1], 7) + FileBin_Hash_Rotl(lane[2], 12) + FileBin_Hash_Rotl(lane[3], 18);
+        for (uint64_t l : lane)
+        {
+            h = (h ^ FileBin_Hash_Round(0, l)) * FILEBIN_HASH_PRIME1 + FILEBIN_HASH_PRIME3;
+        }
+    }
+    else
+    {
+        h = seed + FILEBIN_HASH_PRIME3;
+    }
+
+    h += static_cast<uint64_t>(len);
+
+    for (; data + 8 <= end; data += 8)
+    {
+        h = FileBin_Hash_Rotl(h ^ FileBin_Hash_Round(0, E::Load64(data)), 27) * FILEBIN_HASH_PRIME1 + FILEBIN_HASH_PRIME3;
+    }
+
+    for (; data < end; data++)
+    {
+        h = FileBin_Hash_Rotl(h ^ (*data * FILEBIN_HASH_PRIME3), 11) * FILEBIN_HASH_PRIME1;
+    }
+
+    // Final avalanche
+    h ^= h >> 33;
+    h *= FILEBIN_HASH_PRIME2;
+    h ^= h >> 29;
+    h *= FILEBIN_HASH_PRIME3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+#endif // FILEBIN_HASH_H
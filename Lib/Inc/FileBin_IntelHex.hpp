@@ -4,6 +4,7 @@
 #include <iostream>
 #include <vector>
 #include <QByteArray>
+#include "FileBin_Endian.h"
 
 using namespace std;
 
@@ -87,6 +88,14 @@ class FileBin_IntelHex_Page
 
 class FileBin_IntelHex_Memory
 {
+    private:
+        FileBin_ByteOrder ByteOrder = FILEBIN_BYTEORDER_LITTLE;
+
+        template <typename T>
+        T ReadMem(uint32_t Address);
+        template <typename T>
+        bool WriteMem(uint32_t Address, T value);
+
     public:
         vector<FileBin_IntelHex_Page> Page;
 
@@ -96,6 +105,8 @@ class FileBin_IntelHex_Memory
         bool Save(string filename);
         void Clear(void);
         bool GetMemPageOffset(uint32_t *pPage, uint32_t *pOffset, uint32_t Address);
+        void SetByteOrder(FileBin_ByteOrder Order);
+        FileBin_ByteOrder GetByteOrder(void) const;
 
 
         uint8_t ReadMem_uint8(uint32_t Address);
@@ -0,0 +1,238 @@
+/**
+ *  \file       FileBin_LEB128.h
+ *  \brief      LEB128 decoding kernels
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef FILEBIN_LEB128_H
+#define FILEBIN_LEB128_H
+
+#include <cstdint>
+#include <stdexcept>
+#include "FileBin_Endian.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+/* Most LEB128 values in DWARF (abbrev codes, attributes, forms, small sizes) take one or two bytes and
+ * are decoded inline. Longer ones up to 8 bytes are decoded from a single 64-bit load, the rest byte by
+ * byte. The wide load may read past the value but never into another page, so it cannot fault */
+#define FILEBIN_LEB128_PAGE_SIZE    (4096u)
+#define FILEBIN_LEB128_WORD_BYTES   (8u)
+#define FILEBIN_LEB128_CONT_BITS    (0x8080808080808080ull)
+#define FILEBIN_LEB128_DATA_BITS    (0x7F7F7F7F7F7F7F7Full)
+
+/* Keeps the long paths out of line, so the short ones stay small enough to inline into every caller */
+#if defined(_MSC_VER)
+#define FILEBIN_LEB128_NOINLINE     __declspec(noinline)
+#else
+#define FILEBIN_LEB128_NOINLINE     __attribute__((noinline))
+#endif
+
+static inline uint32_t FileBin_LEB128_Ctz64(uint64_t v)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return static_cast<uint32_t>(idx);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(v));
+#endif
+}
+
+static inline uint64_t FileBin_LEB128_ReadULEBScalar(const uint8_t*& ptr)
+{
+    uint64_t result = 0;
+    unsigned shift = 0;
+
+    while (true)
+    {
+        uint8_t byte = *ptr++;
+        result |= uint64_t(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+            return result;
+
+        shift += 7;
+        if (shift >= 64)
+            throw std::runtime_error("ULEB128 too large");
+    }
+}
+
+static inline int64_t FileBin_LEB128_ReadSLEBScalar(const uint8_t*& ptr)
+{
+    int64_t result = 0;
+    int shift = 0;
+
+    while (true)
+    {
+        uint8_t byte = *ptr++;
+        result |= int64_t(byte & 0x7F) << shift;
+        shift += 7;
+
+        if (!(byte & 0x80))
+        {
+            if (shift < 64 && (byte & 0x40))
+                result |= -((int64_t)1 << shift);
+            return result;
+        }
+    }
+}
+
+/* Value bits of a value of up to 8 bytes from one load, false if it is longer or the load would cross
+ * a page. len is the encoded length */
+static inline bool FileBin_LEB128_ReadWord(const uint8_t* ptr, uint64_t& value, uint32_t& len)
+{
+    if ((reinterpret_cast<uintptr_t>(ptr) & (FILEBIN_LEB128_PAGE_SIZE - 1)) > (FILEBIN_LEB128_PAGE_SIZE - FILEBIN_LEB128_WORD_BYTES))
+    {
+        return false;
+    }
+
+    uint64_t word = FileBin_Endian<FILEBIN_BYTEORDER_LITTLE>::Load64(ptr);
+    uint64_t last = ~word & FILEBIN_LEB128_CONT_BITS; /* Continuation bits that are clear */
+    if (last == 0)
+    {
+        return false;
+    }
+
+    // Keep the bytes up to and including the first one without continuation bit
+    uint32_t endBit = FileBin_LEB128_Ctz64(last);
+    len = (endBit >> 3) + 1;
+    word &= (endBit == 63) ? ~0ull : ((1ull << (endBit + 1)) - 1);
+
+#if defined(__BMI2__)
+    value = _pext_u64(word, FILEBIN_LEB128_DATA_BITS);
+#else
+    // Squeeze the 7-bit groups together: pairs into 14 bits, then 28, then 56
+    word &= FILEBIN_LEB128_DATA_BITS;
+    word = (word & 0x007F007F007F007Full) | ((word & 0x7F007F007F007F00ull) >> 1);
+    word = (word & 0x00003FFF00003FFFull) | ((word & 0x3FFF00003FFF0000ull) >> 2);
+    value = (word & 0x000000000FFFFFFFull) | ((word & 0x0FFFFFFF00000000ull) >> 4);
+#endif
+
+    return true;
+}
+
+static FILEBIN_LEB128_NOINLINE uint64_t FileBin_LEB128_ReadULEBLong(const uint8_t*& ptr)
+{
+    uint64_t value;
+    uint32_t len;
+    if (FileBin_LEB128_ReadWord(ptr, value, len))
+    {
+        ptr += len;
+        return value;
+    }
+
+    return FileBin_LEB128_ReadULEBScalar(ptr);
+}
+
+static inline uint64_t FileBin_LEB128_ReadULEB(const uint8_t*& ptr)
+{
+    uint8_t byte = ptr[0];
+    if ((byte & 0x80) == 0)
+    {
+        ptr += 1;
+        return byte;
+    }
+
+    if ((ptr[1] & 0x80) == 0)
+    {
+        uint64_t result = (byte & 0x7Fu) | (static_cast<uint64_t>(ptr[1]) << 7);
+        ptr += 2;
+        return result;
+    }
+
+    return FileBin_LEB128_ReadULEBLong(ptr);
+}
+
+static FILEBIN_LEB128_NOINLINE int64_t FileBin_LEB128_ReadSLEBLong(const uint8_t*& ptr)
+{
+    uint64_t value;
+    uint32_t len;
+    if (FileBin_LEB128_ReadWord(ptr, value, len))
+    {
+        uint32_t unused = 64 - 7 * len;
+        ptr += len;
+        return static_cast<int64_t>(value << unused) >> unused;
+    }
+
+    return FileBin_LEB128_ReadSLEBScalar(ptr);
+}
+
+static inline int64_t FileBin_LEB128_ReadSLEB(const uint8_t*& ptr)
+{
+    // Sign extension from the top value bit, 7 bits per encoded byte
+    uint8_t byte = ptr[0];
+    if ((byte & 0x80) == 0)
+    {
+        ptr += 1;
+        return static_cast<int64_t>(static_cast<uint64_t>(byte) << 57) >> 57;
+    }
+
+    if ((ptr[1] & 0x80) == 0)
+    {
+        uint64_t bits = (byte & 0x7Fu) | (static_cast<uint64_t>(ptr[1]) << 7);
+        ptr += 2;
+        return static_cast<int64_t>(bits << 50) >> 50;
+    }
+
+    return FileBin_LEB128_ReadSLEBLong(ptr);
+}
+
+/* Steps over a value of either signedness without decoding it */
+static inline void FileBin_LEB128_Skip(const uint8_t*& ptr)
+{
+    if ((ptr[0] & 0x80) == 0)
+    {
+        ptr += 1;
+        return;
+    }
+
+    if ((reinterpret_cast<uintptr_t>(ptr) & (FILEBIN_LEB128_PAGE_SIZE - 1)) <= (FILEBIN_LEB128_PAGE_SIZE - FILEBIN_LEB128_WORD_BYTES))
+    {
+        uint64_t last = ~FileBin_Endian<FILEBIN_BYTEORDER_LITTLE>::Load64(ptr) & FILEBIN_LEB128_CONT_BITS;
+        if (last != 0)
+        {
+            ptr += (FileBin_LEB128_Ctz64(last) >> 3) + 1;
+            return;
+        }
+    }
+
+    while (*ptr++ & 0x80);
+}
+
+#endif // FILEBIN_LEB128_H
@@ -0,0 +1,74 @@
+/**
+ *  \file       FileBin_MappedFile.h
+ *  \brief      Read-only memory mapped file
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+#ifndef FILEBIN_MAPPEDFILE_H
+#define FILEBIN_MAPPEDFILE_H
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/* Read-only view of a whole file. The mapping stays valid until close() or destruction,
+ * so pointers handed out from data may be kept by the owner for its whole lifetime */
+class MappedFile
+{
+    public:
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+
+    private:
+#if defined(_WIN32) || defined(_WIN64)
+        void* hFile = nullptr;
+        void* hMap = nullptr;
+#else
+        int fd = -1;
+#endif
+
+    public:
+        MappedFile(void) = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const std::string& fileName);
+        void close(void);
+        bool isOpen(void) const;
+
+        /* Bounds checked access, returns nullptr if [offset, offset + len) is not fully mapped */
+        const uint8_t* at(uint64_t offset, uint64_t len) const;
+
+        ~MappedFile()
+        {
+            close();
+        }
+};
+
+#endif // FILEBIN_MAPPEDFILE_H
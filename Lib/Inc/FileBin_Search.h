@@ -0,0 +1,64 @@
+/**
+ *  \file       FileBin_Search.h
+ *  \brief      Trigram substring index over names
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#ifndef FILEBIN_SEARCH_H
+#define FILEBIN_SEARCH_H
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/* Case-insensitive substring search over names. Each entry is split into trigrams and its id appended
+ * to their posting lists, so entries can be added at any time and lists stay sorted. Queries verify the
+ * candidates of their rarest trigram. Texts are views, they must outlive the index entries */
+class FileBin_SearchIndex
+{
+    private:
+        std::vector<std::string_view> Text;
+        std::vector<const void*> Item;
+        std::unordered_map<uint32_t, std::vector<uint32_t>> Posting; /* Trigram to ids of the entries holding it */
+
+        static bool Contains(std::string_view text, std::string_view lowerQuery);
+
+    public:
+        void Add(std::string_view text, const void* item);
+        void Clear(void);
+        uint32_t Size(void) const;
+
+        /* Items whose text contains the query, in insertion order, at most maxResults of them */
+        std::vector<const void*> Find(std::string_view query, uint32_t maxResults) const;
+};
+
+#endif // FILEBIN_SEARCH_H
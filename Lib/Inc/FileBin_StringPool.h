@@ -0,0 +1,93 @@
+/**
+ *  \file       FileBin_StringPool.h
+ *  \brief      Interned names with 32-bit ids
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#ifndef FILEBIN_STRINGPOOL_H
+#define FILEBIN_STRINGPOOL_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#define FILEBIN_STRINGPOOL_SHARD_BITS   (4)
+#define FILEBIN_STRINGPOOL_SHARD_CNT    (1u << FILEBIN_STRINGPOOL_SHARD_BITS)
+
+/* Each distinct name is kept once and known by a 32-bit id, so equal names compare as equal ids.
+ * Id 0 is the empty name. The pool keeps views, the text must outlive it (mapped file, literals).
+ * Intern() may run from several threads, it is split in shards to keep them apart. Get() and Find()
+ * must not run while another thread interns */
+class FileBin_StringPool
+{
+    private:
+        typedef struct
+        {
+            mutable std::mutex Lock;
+            mutable std::unordered_map<std::string_view, uint32_t> Ids;
+            mutable uint32_t IndexedCnt = 0; /* Names below this index are in Ids, see Restore() */
+            std::vector<std::string_view> Names;
+            std::vector<std::unique_ptr<char[]>> Storage; /* Text copied by Own() */
+            uint32_t OwnedCnt = 0; /* Names below this index point into Storage */
+        } ShardType;
+
+        ShardType Shard[FILEBIN_STRINGPOOL_SHARD_CNT];
+
+        void Index(uint32_t shardIdx) const; /* Adds the restored names of a shard to its lookup index */
+
+    public:
+        FileBin_StringPool(void);
+
+        uint32_t Intern(std::string_view text);
+        uint32_t Find(std::string_view text) const; /* 0 if the name was never interned */
+        std::string_view Get(uint32_t id) const;
+        uint32_t Size(void) const;
+        void Clear(void);
+
+        /* Visits every name with its id, shard by shard in id order. Interning them in that order into a
+         * cleared pool hands out the same ids again */
+        void ForEach(const std::function<void(uint32_t, std::string_view)>& fn) const;
+
+        /* Puts back a name under the id ForEach() gave it, in the same order. Nothing is hashed, the
+         * lookup index of a shard is built on its next Intern() or Find(). False if the id is out of
+         * order or already holds another name */
+        bool Restore(uint32_t id, std::string_view text);
+
+        /* Copies the text of every name into the pool, so it no longer depends on the memory it was
+         * interned from. Ids stay the same */
+        void Own(void);
+};
+
+#endif // FILEBIN_STRINGPOOL_H
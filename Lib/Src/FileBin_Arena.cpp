@@ -0,0 +1,80 @@
+/**
+ *  \file       FileBin_Arena.cpp
+ *  \brief      Bump arena for parser nodes and their payloads
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+#include "FileBin_Arena.h"
+
+FileBin_Arena::FileBin_Arena(size_t blockSize) : BlockSize(blockSize)
+{
+}
+
+FileBin_Arena::~FileBin_Arena()
+{
+    Reset();
+}
+
+void* FileBin_Arena::AllocateSlow(size_t size, size_t align)
+{
+    /* Oversized requests get a block of their own so the current block keeps its free space */
+    size_t blockSize = (size + align > BlockSize) ? (size + align) : BlockSize;
+    uint8_t* block = static_cast<uint8_t*>(::operator new(blockSize));
+    Block.push_back(block);
+
+    uintptr_t p = (reinterpret_cast<uintptr_t>(block) + (align - 1)) & ~static_cast<uintptr_t>(align - 1);
+
+    if (blockSize == BlockSize)
+    {
+        Cur = reinterpret_cast<uint8_t*>(p + size);
+        End = block + blockSize;
+    }
+
+    BytesUsed += size;
+    return reinterpret_cast<void*>(p);
+}
+
+void FileBin_Arena::Reset(void)
+{
+    for (uint8_t* block : Block)
+    {
+        ::operator delete(block);
+    }
+
+    Block.clear();
+    Cur = nullptr;
+    End = nullptr;
+    BytesUsed = 0;
+}
+
+size_t FileBin_Arena::GetBytesUsed(void) const
+{
+    return BytesUsed;
+}
@@ -0,0 +1,102 @@
+/**
+ *  \file       FileBin_DIEIndex.cpp
+ *  \brief      DIE rows of all units by .debug_info offset
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#include "FileBin_DIEIndex.h"
+#include <vector>
+
+/* DIE offsets are dense and small, mixed so neighbouring DIEs land in different shards */
+static inline uint32_t FileBin_DIEIndex_ShardOf(uint64_t offset)
+{
+    return static_cast<uint32_t>((offset * 0x9E3779B97F4A7C15ull) >> (64 - FILEBIN_DIEINDEX_SHARD_BITS));
+}
+
+void FileBin_DIEIndex::Insert(uint32_t unit, const uint64_t* offsets, const uint32_t* rows, uint32_t count)
+{
+    // Entries grouped by shard first, so each lock is taken once per unit
+    std::vector<uint32_t> start(FILEBIN_DIEINDEX_SHARD_CNT + 1, 0);
+    std::vector<uint32_t> order(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        start[FileBin_DIEIndex_ShardOf(offsets[i]) + 1]++;
+    }
+    for (uint32_t shardIdx = 0; shardIdx < FILEBIN_DIEINDEX_SHARD_CNT; shardIdx++)
+    {
+        start[shardIdx + 1] += start[shardIdx];
+    }
+
+    std::vector<uint32_t> fill(start.begin(), start.end() - 1);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        order[fill[FileBin_DIEIndex_ShardOf(offsets[i])]++] = i;
+    }
+
+    for (uint32_t shardIdx = 0; shardIdx < FILEBIN_DIEINDEX_SHARD_CNT; shardIdx++)
+    {
+        if (start[shardIdx] == start[shardIdx + 1])
+        {
+            continue;
+        }
+
+        ShardType& shard = this->Shard[shardIdx];
+        std::lock_guard<std::mutex> lock(shard.Lock);
+
+        for (uint32_t pos = start[shardIdx]; pos < start[shardIdx + 1]; pos++)
+        {
+            uint32_t i = order[pos];
+            shard.Entries.emplace(offsets[i], EntryType{unit, rows[i]});
+        }
+    }
+}
+
+bool FileBin_DIEIndex::Find(uint64_t offset, EntryType& entry) const
+{
+    const ShardType& shard = this->Shard[FileBin_DIEIndex_ShardOf(offset)];
+    auto it = shard.Entries.find(offset);
+    if (it == shard.Entries.end())
+    {
+        return false;
+    }
+
+    entry = it->second;
+    return true;
+}
+
+void FileBin_DIEIndex::Clear(void)
+{
+    for (ShardType& shard : this->Shard)
+    {
+        shard.Entries.clear();
+    }
+}
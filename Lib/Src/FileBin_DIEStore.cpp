@@ -0,0 +1,176 @@
+/**
+ *  \file       FileBin_DIEStore.cpp
+ *  \brief      Columnar storage of decoded DIEs
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+
+#include "FileBin_DIEStore.h"
+
+uint32_t FileBin_DIEStore::Append(uint8_t tag, uint32_t parent)
+{
+    uint32_t row = static_cast<uint32_t>(this->Tag.size());
+
+    this->Tag.push_back(tag);
+    this->Flags.push_back(0);
+    this->Encoding.push_back(0);
+    this->DimCount.push_back(0);
+    this->Parent.push_back(parent);
+    this->FirstChild.push_back(FILEBIN_DIESTORE_NONE);
+    this->Sibling.push_back(FILEBIN_DIESTORE_NONE);
+    this->NameId.push_back(0);
+    this->TypeOffset.push_back(0);
+    this->Location.push_back(0);
+    this->Addr.push_back(0);
+    this->Dims.push_back({});
+
+    return row;
+}
+
+void FileBin_DIEStore::AddDim(uint32_t row, uint32_t value)
+{
+    uint8_t count = this->DimCount[row];
+
+    if (count < FILEBIN_DIESTORE_INLINE_DIMS)
+    {
+        this->Dims[row][count] = value;
+    }
+    else
+    {
+        this->DimSpill[row].push_back(value);
+    }
+
+    this->DimCount[row] = count + 1;
+}
+
+uint32_t FileBin_DIEStore::GetDim(uint32_t row, uint32_t idx) const
+{
+    if (idx >= this->DimCount[row])
+    {
+        return 0;
+    }
+
+    if (idx < FILEBIN_DIESTORE_INLINE_DIMS)
+    {
+        return this->Dims[row][idx];
+    }
+
+    return this->DimSpill.at(row)[idx - FILEBIN_DIESTORE_INLINE_DIMS];
+}
+
+void FileBin_DIEStore::SetPending(uint32_t row, const uint8_t* children)
+{
+    this->Pending[row] = children;
+}
+
+const uint8_t* FileBin_DIEStore::TakePending(uint32_t row)
+{
+    auto it = this->Pending.find(row);
+    if (it == this->Pending.end())
+    {
+        return nullptr;
+    }
+
+    const uint8_t* children = it->second;
+    this->Pending.erase(it);
+
+    return children;
+}
+
+bool FileBin_DIEStore::IsPending(uint32_t row) const
+{
+    return !this->Pending.empty() && (this->Pending.find(row) != this->Pending.end());
+}
+
+const std::unordered_map<uint32_t, std::vector<uint32_t>>& FileBin_DIEStore::GetDimSpill(void) const
+{
+    return this->DimSpill;
+}
+
+void FileBin_DIEStore::SetDimSpill(uint32_t row, const uint32_t* values, uint32_t count)
+{
+    this->DimSpill[row].assign(values, values + count);
+}
+
+void FileBin_DIEStore::Reserve(uint32_t rows)
+{
+    this->Tag.reserve(rows);
+    this->Flags.reserve(rows);
+    this->Encoding.reserve(rows);
+    this->DimCount.reserve(rows);
+    this->Parent.reserve(rows);
+    this->FirstChild.reserve(rows);
+    this->Sibling.reserve(rows);
+    this->NameId.reserve(rows);
+    this->TypeOffset.reserve(rows);
+    this->Location.reserve(rows);
+    this->Addr.reserve(rows);
+    this->Dims.reserve(rows);
+}
+
+void FileBin_DIEStore::Own(void)
+{
+    this->Tag.Own();
+    this->Flags.Own();
+    this->Encoding.Own();
+    this->DimCount.Own();
+    this->Parent.Own();
+    this->FirstChild.Own();
+    this->Sibling.Own();
+    this->NameId.Own();
+    this->TypeOffset.Own();
+    this->Location.Own();
+    this->Addr.Own();
+    this->Dims.Own();
+}
+
+uint32_t FileBin_DIEStore::Rows(void) const
+{
+    return static_cast<uint32_t>(this->Tag.size());
+}
+
+void FileBin_DIEStore::Clear(void)
+{
+    this->Tag.clear();
+    this->Flags.clear();
+    this->Encoding.clear();
+    this->DimCount.clear();
+    this->Parent.clear();
+    this->FirstChild.clear();
+    this->Sibling.clear();
+    this->NameId.clear();
+    this->TypeOffset.clear();
+    this->Location.clear();
+    this->Addr.clear();
+    this->Dims.clear();
+    this->DimSpill.clear();
+    this->Pending.clear();
+}
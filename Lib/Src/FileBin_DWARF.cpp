@@ -32,136 +32,127 @@
 
 #include "FileBin_DWARF.h"
 #include "FileBin_DWARF_Def.h"
+#include "FileBin_ELF.h"
+#include "FileBin_MappedFile.h"
+#include "FileBin_Endian.h"
+#include "FileBin_Hash.h"
+#include "FileBin_LEB128.h"
 #include <cassert>
-#include <queue>
 #include <string>
 #include <cstring>
 #include <iostream>
 #include <thread>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <unordered_set>
 
-#if defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#else
-#include <sys/mman.h>
-#include <sys/stat.h>
-#include <fcntl.h>
-#include <unistd.h>
-#endif
+#define LIBPARSER_DWARF_BYTESLEBMAX (24)
+#define LIBPARSER_DWARF_BITSPERBYTE (8)
+#define LIBPARSER_DWARF_DEBUG_ABBRV (0)
+#define LIBPARSER_DWARF_DEBUG       (0)
 
-class MappedFile
+/* Base type classification, rows are DW_ATE_* encodings and columns byte sizes 1, 2, 4 and 8 */
+static const FileBin_DWARF_VarInfoLenType FileBin_DWARF_BaseTypeTable[DW_ATE_UTF + 1][4] =
 {
-    public:
-        const uint8_t* data = nullptr;
-        size_t size = 0;
-
-#if defined(_WIN32) || defined(_WIN64)
-    private:
-        HANDLE hFile = INVALID_HANDLE_VALUE;
-        HANDLE hMap = NULL;
-#else
-    private:
-        int fd = -1;
-#endif
+    /* 0x00 -                   */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_address           */ { FileBin_VARINFO_TYPE_UINT8,    FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+    /* DW_ATE_boolean           */ { FileBin_VARINFO_TYPE_BOOLEAN,  FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+    /* DW_ATE_complex_float     */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_float (half raw)  */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_FLOAT32,  FileBin_VARINFO_TYPE_FLOAT64  },
+    /* DW_ATE_signed            */ { FileBin_VARINFO_TYPE_SINT8,    FileBin_VARINFO_TYPE_SINT16,   FileBin_VARINFO_TYPE_SINT32,   FileBin_VARINFO_TYPE_SINT64   },
+    /* DW_ATE_signed_char       */ { FileBin_VARINFO_TYPE_SINT8,    FileBin_VARINFO_TYPE_SINT16,   FileBin_VARINFO_TYPE_SINT32,   FileBin_VARINFO_TYPE_SINT64   },
+    /* DW_ATE_unsigned          */ { FileBin_VARINFO_TYPE_UINT8,    FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+    /* DW_ATE_unsigned_char     */ { FileBin_VARINFO_TYPE_UINT8,    FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+    /* DW_ATE_imaginary_float   */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_packed_decimal    */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_numeric_string    */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_edited            */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_signed_fixed      */ { FileBin_VARINFO_TYPE_SINT8,    FileBin_VARINFO_TYPE_SINT16,   FileBin_VARINFO_TYPE_SINT32,   FileBin_VARINFO_TYPE_SINT64   },
+    /* DW_ATE_unsigned_fixed    */ { FileBin_VARINFO_TYPE_UINT8,    FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+    /* DW_ATE_decimal_float     */ { FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN, FileBin_VARINFO_TYPE__UNKNOWN },
+    /* DW_ATE_UTF               */ { FileBin_VARINFO_TYPE_UINT8,    FileBin_VARINFO_TYPE_UINT16,   FileBin_VARINFO_TYPE_UINT32,   FileBin_VARINFO_TYPE_UINT64   },
+};
 
-    public:
-        bool open(const std::string& fileName)
-        {
-#if defined(_WIN32) || defined(_WIN64)
-            hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-            if (hFile == INVALID_HANDLE_VALUE)
-            {
-                return false;
-            }
+/* Value type of a base type from its encoding and size, independent of the compiler spelling of its name */
+static FileBin_DWARF_VarInfoLenType FileBin_DWARF_BaseTypeClassify(uint8_t encoding, uint32_t byteSize)
+{
+    uint32_t sizeIdx;
 
-            LARGE_INTEGER fsize;
-            if (!GetFileSizeEx(hFile, &fsize))
-            {
-                return false;
-            }
+    switch (byteSize)
+    {
+        case 1:  sizeIdx = 0; break;
+        case 2:  sizeIdx = 1; break;
+        case 4:  sizeIdx = 2; break;
+        case 8:  sizeIdx = 3; break;
+        default: return FileBin_VARINFO_TYPE__UNKNOWN;
+    }
 
-            size = static_cast<size_t>(fsize.QuadPart);
+    return (encoding <= DW_ATE_UTF) ? FileBin_DWARF_BaseTypeTable[encoding][sizeIdx] : FileBin_VARINFO_TYPE__UNKNOWN;
+}
 
-            hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
-            if (!hMap)
-            {
-                return false;
-            }
+FileBin_DWARF::FileBin_DWARF(void)
+{
+    this->SymbolRoot = nullptr;
+    this->InternLabels();
+}
 
-            data = static_cast<const uint8_t*>(MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
-            if (!data)
-            {
-                return false;
-            }
-#else
-            fd = ::open(fileName.c_str(), O_RDONLY);
-            if (fd < 0)
-            {
-                return false;
-            }
+FileBin_DWARF::~FileBin_DWARF()
+{
+    this->Reset();
+}
 
-            struct stat st;
-            if (fstat(fd, &st) < 0)
-            {
-                return false;
-            }
+void FileBin_DWARF::Reset()
+{
+    /* DIE stores and symbol nodes belong to the units, dropping the units frees them all at once */
+    for (auto* cu : this->CompilationUnit)
+    {
+        delete cu;
+    }
+    this->CompilationUnit.clear();
 
-            size = st.st_size;
+    this->ResetIndexes();
+    this->Names.Clear();
+    this->InternLabels();
+    this->CacheFile.close();
+}
 
-            data = static_cast<const uint8_t*>(mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
-            if (data == MAP_FAILED)
-            {
-                return false;
-            }
-#endif
-            return true;
-        }
+void FileBin_DWARF::InternLabels(void)
+{
+    /* Interned once up front, the symbol traversal workers only copy the ids */
+    this->ConstLabelId = this->Names.Intern("CON");
+    this->VolatileLabelId = this->Names.Intern("VOLATILE");
+    this->PointerLabelId = this->Names.Intern("TIP");
+    this->StructLabelId = this->Names.Intern("STR");
+    this->EnumLabelId = this->Names.Intern("ENU");
+    this->ArrayLabelId = this->Names.Intern("ARR");
+    this->DimLabelId = this->Names.Intern("DIMAY");
+}
 
-        void close(void)
-        {
-#if defined(_WIN32) || defined(_WIN64)
-            if (data)
-            {
-                UnmapViewOfFile(data);
-            }
-            if (hMap)
-            {
-                CloseHandle(hMap);
-            }
-            if (hFile != INVALID_HANDLE_VALUE)
-            {
-                CloseHandle(hFile);
-            }
-#else
-            if (data)
-            {
-                munmap((void*)data, size);
-            }
-            if (fd >= 0)
-            {
-                ::close(fd);
-            }
-#endif
-            data = nullptr;
-            size = 0;
-        }
+void FileBin_DWARF::ResetIndexes(void)
+{
+    /* Everything built across units, the units themselves are left alone */
+    this->DataRoot = FileBin_DWARF_DieCursor();
+    this->SymbolRoot = nullptr;
 
-        ~MappedFile()
-        {
-            close();
-        }
-};
+    this->AbbrevOffsetCache.clear();
 
-#define LIBPARSER_DWARF_BYTESLEBMAX (24)
-#define LIBPARSER_DWARF_BITSPERBYTE (8)
-#define LIBPARSER_DWARF_DEBUG_ABBRV (0)
-#define LIBPARSER_DWARF_DEBUG       (0)
+    this->UnitIndex.clear();
+    this->SymbolIndex.clear();
+    this->SymbolIndexComplete = false;
+    this->SymbolSearch.Clear();
+    this->DIESearch.Clear();
+    this->DIESearchRefs.clear();
+    this->DieIndex.Clear();
+    this->TypeUnits.clear();
+}
 
-FileBin_DWARF::FileBin_DWARF(void)
+std::string_view FileBin_DWARF::GetName(uint32_t nameId) const
 {
-    this->DataRoot = nullptr;
-    this->SymbolRoot = nullptr;
+    return this->Names.Get(nameId);
 }
 
 std::string FileBin_DWARF::FileBin_DWARF_DW_TAG_ToString(uint16_t StrCode)
@@ -438,60 +429,39 @@ std::string FileBin_DWARF::FileBin_DWARF_DW_FORM_ToString(uint16_t StrCode)
 
 inline uint64_t FileBin_DWARF::FileBin_DWARF_ReadULEB128(const uint8_t*& ptr)
 {
-    uint64_t result = 0;
-    unsigned shift = 0;
-
-    while (true)
-    {
-        uint8_t byte = *ptr++;
-        result |= uint64_t(byte & 0x7F) << shift;
-
-        if ((byte & 0x80) == 0)
-            return result;
-
-        shift += 7;
-        if (shift >= 64)
-            throw std::runtime_error("ULEB128 too large");
-    }
+    return FileBin_LEB128_ReadULEB(ptr);
 }
 
 inline int64_t FileBin_DWARF::FileBin_DWARF_ReadSLEB128(const uint8_t*& ptr)
 {
-    int64_t result = 0;
-    int shift = 0;
-
-    while (true)
-    {
-        uint8_t byte = *ptr++;
-        result |= int64_t(byte & 0x7F) << shift;
-        shift += 7;
-
-        if (!(byte & 0x80))
-        {
-            if (shift < 64 && (byte & 0x40))
-                result |= -((int64_t)1 << shift);
-            return result;
-        }
-    }
+    return FileBin_LEB128_ReadSLEB(ptr);
 }
 
-FileBin_DWARF_CompileUnitDataType* FileBin_DWARF::ParseAbbrevOffset(const uint8_t* abbrevPtr)
+FileBin_DWARF_CompileUnitDataType* FileBin_DWARF::ParseAbbrevOffset(const uint8_t* abbrevPtr, uint8_t offsetSize)
 {
-    uint32_t abbrevOffset = static_cast<uint32_t>(abbrevPtr - this->fileBase); // fileBase = mmap base
+    // fileBase = mmap base, tables of split units in other mappings get distinct keys the same way
+    uint64_t abbrevOffset = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(abbrevPtr) - reinterpret_cast<uintptr_t>(this->fileBase));
+
+    /* Plans hold form sizes, a table shared by 32-bit and 64-bit DWARF units is compiled once for each */
+    uint64_t cacheKey = (abbrevOffset << 1) | ((offsetSize == 8) ? 1u : 0u);
 
     /* The Abbrev are stored using their offset in the file as unique identifier (will be user later for .debug_info structure
      * info retrieval). Each abbrev will store an array of DW_TAG number that will include a set of DW_AT + DW_FORM */
-    std::unordered_map<uint32_t, FileBin_DWARF_CompileUnitDataType>::iterator it = AbbrevOffsetCache.find(abbrevOffset);
-
-    /* If abbrev offset already parsed, skip it */
-    if (it != AbbrevOffsetCache.end())
     {
-        std::cout << "already parsed" << std::endl;
-        return &it->second;
+        std::lock_guard<std::mutex> lock(AbbrevOffsetCacheMutex);
+        std::unordered_map<uint64_t, FileBin_DWARF_CompileUnitDataType>::iterator it = AbbrevOffsetCache.find(cacheKey);
+
+        /* If abbrev offset already parsed, skip it */
+        if (it != AbbrevOffsetCache.end())
+        {
+            return &it->second;
+        }
     }
 
+    /* Decode outside the lock, units sharing a table may race here and the first insert wins */
     FileBin_DWARF_CompileUnitDataType cu;
     cu.abbrevOffset = abbrevOffset;
+    cu.offsetSize = offsetSize;
 
     const uint8_t* ptr = abbrevPtr;
 
@@ -525,14 +495,37 @@ FileBin_DWARF_CompileUnitDataType* FileBin_DWARF::ParseAbbrevOffset(const uint8_
 #if (1 == LIBPARSER_DWARF_DEBUG)
             std::cout << "  Attr " << FileBin_DWARF_DW_AT_ToString(attr) << "\n";
 #endif
-            abbrev.attributes.push_back({static_cast<uint32_t>(attr), static_cast<uint32_t>(form)});
+            FileBin_DWARF_AbbrevAttr attrForm;
+            attrForm.attribute = static_cast<uint32_t>(attr);
+            attrForm.form = static_cast<uint32_t>(form);
+            if (form == DW_FORM_implicit_const)
+            {
+                // The value is shared by every DIE using the abbrev
+                attrForm.implicitConst = FileBin_DWARF_ReadSLEB128(ptr);
+            }
+            abbrev.attributes.push_back(attrForm);
         }
 
-        cu.abbrevTable.emplace(abbrev.code, std::move(abbrev));
+        /* Compile once, every DIE using this code then decodes straight from the plan */
+        CompileAbbrev(abbrev, offsetSize);
+
+        if (abbrev.code < FILEBIN_DWARF_ABBREV_DENSE_MAX)
+        {
+            if (abbrev.code >= cu.abbrevTable.size())
+            {
+                cu.abbrevTable.resize(abbrev.code + 1);
+            }
+            cu.abbrevTable[abbrev.code] = std::move(abbrev);
+        }
+        else
+        {
+            cu.abbrevSparse.emplace(abbrev.code, std::move(abbrev));
+        }
     }
 
     // Cache and return
-    auto [insIt, _] = AbbrevOffsetCache.emplace(abbrevOffset, std::move(cu));
+    std::lock_guard<std::mutex> lock(AbbrevOffsetCacheMutex);
+    auto [insIt, _] = AbbrevOffsetCache.emplace(cacheKey, std::move(cu));
 
     return &insIt->second;
 }
@@ -541,14 +534,27 @@ void FileBin_DWARF::PrintAllAbbrevInfo() const
 {
     for (const auto& cachePair : AbbrevOffsetCache)
     {
-        uint32_t abbrevOffset = cachePair.first;
         const FileBin_DWARF_CompileUnitDataType& cu = cachePair.second;
 
-        std::cout << "Abbrev Table at Offset: 0x" << std::hex << abbrevOffset << std::dec << "\n";
+        std::cout << "Abbrev Table at Offset: 0x" << std::hex << cu.abbrevOffset << std::dec
+                  << ((cu.offsetSize == 8) ? " (DWARF64)" : "") << "\n";
+
+        std::vector<const FileBin_DWARF_Abbrev*> abbrevList;
+        for (const FileBin_DWARF_Abbrev& abbrev : cu.abbrevTable)
+        {
+            if (abbrev.code != 0)
+            {
+                abbrevList.push_back(&abbrev);
+            }
+        }
+        for (const auto& pair : cu.abbrevSparse)
+        {
+            abbrevList.push_back(&pair.second);
+        }
 
-        for (const auto& pair : cu.abbrevTable)
+        for (const FileBin_DWARF_Abbrev* abbrevPtr : abbrevList)
         {
-            const FileBin_DWARF_Abbrev& abbrev = pair.second;
+            const FileBin_DWARF_Abbrev& abbrev = *abbrevPtr;
             std::cout << "  Abbrev Code: " << abbrev.code
                       << " Tag: " << FileBin_DWARF_DW_TAG_ToString(abbrev.tag)
                       << " HasChildren: " << abbrev.hasChildren << "\n";
@@ -562,698 +568,1018 @@ void FileBin_DWARF::PrintAllAbbrevInfo() const
     }
 }
 
-static uint16_t readU16(const uint8_t*& p)
+int8_t FileBin_DWARF::FormFixedSize(uint64_t form, uint8_t offsetSize)
+{
+    switch (form)
+    {
+        case DW_FORM_flag_present:
+        case DW_FORM_implicit_const:
+            return 0;
+
+        case DW_FORM_data1:
+        case DW_FORM_ref1:
+        case DW_FORM_flag:
+        case DW_FORM_strx1:
+        case DW_FORM_addrx1:
+            return 1;
+
+        case DW_FORM_data2:
+        case DW_FORM_ref2:
+        case DW_FORM_strx2:
+        case DW_FORM_addrx2:
+            return 2;
+
+        case DW_FORM_strx3:
+        case DW_FORM_addrx3:
+            return 3;
+
+        case DW_FORM_data4:
+        case DW_FORM_ref4:
+        case DW_FORM_ref_sup4:
+        case DW_FORM_strx4:
+        case DW_FORM_addrx4:
+            return 4;
+
+        /* Section offsets, 4 bytes in 32-bit DWARF and 8 in 64-bit DWARF */
+        case DW_FORM_strp:
+        case DW_FORM_sec_offset:
+        case DW_FORM_line_strp:
+        case DW_FORM_strp_sup:
+        case DW_FORM_GNU_ref_alt:
+        case DW_FORM_GNU_strp_alt:
+            return static_cast<int8_t>(offsetSize);
+
+        case DW_FORM_data8:
+        case DW_FORM_ref8:
+        case DW_FORM_ref_sig8:
+        case DW_FORM_ref_sup8:
+            return 8;
+
+        case DW_FORM_data16:
+            return 16;
+
+        case DW_FORM_addr:
+            return FILEBIN_DWARF_FORM_SIZE_ADDR;
+
+        default:
+            return FILEBIN_DWARF_FORM_SIZE_VARIABLE;
+    }
+}
+
+void FileBin_DWARF::CompileAbbrev(FileBin_DWARF_Abbrev& abbrev, uint8_t offsetSize)
+{
+    /* Element type and whether the DIE is a type referenced through DW_AT_type */
+    switch (abbrev.tag)
+    {
+        case DW_TAG_compile_unit:       abbrev.elementType = FILEBIN_DWARF_ELEMENT_COMPILE_UNIT;                        break;
+        case DW_TAG_enumeration_type:   abbrev.elementType = FILEBIN_DWARF_ELEMENT_ENUMERATION; abbrev.isType = true;   break;
+        case DW_TAG_enumerator:         abbrev.elementType = FILEBIN_DWARF_ELEMENT_ENUMERATION;                         break;
+        case DW_TAG_volatile_type:      abbrev.elementType = FILEBIN_DWARF_ELEMENT_VOLATILE;    abbrev.isType = true;   break;
+        case DW_TAG_array_type:         abbrev.elementType = FILEBIN_DWARF_ELEMENT_ARRAY;       abbrev.isType = true;   break;
+        case DW_TAG_subrange_type:      abbrev.elementType = FILEBIN_DWARF_ELEMENT_ARRAY_DIM;                           break;
+        case DW_TAG_typedef:            abbrev.elementType = FILEBIN_DWARF_ELEMENT_TYPEDEF;     abbrev.isType = true;   break;
+        case DW_TAG_base_type:          abbrev.elementType = FILEBIN_DWARF_ELEMENT_BASE_TYPE;   abbrev.isType = true;   break;
+        case DW_TAG_structure_type:     abbrev.elementType = FILEBIN_DWARF_ELEMENT_STRUCTURE;   abbrev.isType = true;   break;
+        case DW_TAG_member:             abbrev.elementType = FILEBIN_DWARF_ELEMENT_MEMBER;      abbrev.isType = true;   break;
+        case DW_TAG_variable:           abbrev.elementType = FILEBIN_DWARF_ELEMENT_VARIABLE;                            break;
+        case DW_TAG_const_type:         abbrev.elementType = FILEBIN_DWARF_ELEMENT_CONSTANT;    abbrev.isType = true;   break;
+
+        /* Code scopes only hold locals and parameters, never reached from a global symbol */
+        case DW_TAG_subprogram:
+        case DW_TAG_lexical_block:
+        case DW_TAG_inlined_subroutine:
+            abbrev.skipChildren = abbrev.hasChildren;
+            break;
+
+        default:
+            break;
+    }
+
+    /* Attribute slots the tag cares about, everything else is skipped by size */
+    for (FileBin_DWARF_AbbrevAttr& attrForm : abbrev.attributes)
+    {
+        attrForm.fixedSize = FormFixedSize(attrForm.form, offsetSize);
+
+        switch (attrForm.attribute)
+        {
+            case DW_AT_name:
+            {
+                switch (abbrev.tag)
+                {
+                    case DW_TAG_compile_unit:
+                    case DW_TAG_enumeration_type:
+                    case DW_TAG_enumerator:
+                    case DW_TAG_base_type:
+                    case DW_TAG_member:
+                    case DW_TAG_variable:
+                        attrForm.slot = FILEBIN_DWARF_SLOT_NAME;
+                        break;
+                }
+                break;
+            }
+
+            case DW_AT_type:
+            {
+                switch (abbrev.tag)
+                {
+                    case DW_TAG_volatile_type:
+                    case DW_TAG_array_type:
+                    case DW_TAG_subrange_type:
+                    case DW_TAG_typedef:
+                    case DW_TAG_structure_type:
+                    case DW_TAG_member:
+                    case DW_TAG_variable:
+                    case DW_TAG_const_type:
+                        attrForm.slot = FILEBIN_DWARF_SLOT_TYPE;
+                        break;
+                }
+                break;
+            }
+
+            case DW_AT_byte_size:
+            {
+                if ((abbrev.tag == DW_TAG_enumeration_type) || (abbrev.tag == DW_TAG_base_type) || (abbrev.tag == DW_TAG_structure_type))
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_BYTE_SIZE;
+                }
+                break;
+            }
+
+            case DW_AT_encoding:
+            {
+                if (abbrev.tag == DW_TAG_base_type)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_ENCODING;
+                }
+                break;
+            }
+
+            case DW_AT_count:
+            {
+                if (abbrev.tag == DW_TAG_subrange_type)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_COUNT;
+                }
+                break;
+            }
+
+            case DW_AT_upper_bound:
+            {
+                if (abbrev.tag == DW_TAG_subrange_type)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_UPPER_BOUND;
+                }
+                break;
+            }
+
+            case DW_AT_data_member_location:
+            {
+                if (abbrev.tag == DW_TAG_member)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_MEMBER_LOCATION;
+                }
+                break;
+            }
+
+            case DW_AT_location:
+            {
+                if (abbrev.tag == DW_TAG_variable)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_LOCATION;
+                }
+                break;
+            }
+
+            case DW_AT_declaration:
+            {
+                if (abbrev.tag == DW_TAG_variable)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_DECLARATION;
+                }
+                break;
+            }
+
+            case DW_AT_specification:
+            case DW_AT_abstract_origin:
+            {
+                // Both name the DIE a variable definition completes, the out-of-line instance of LTO units too
+                if (abbrev.tag == DW_TAG_variable)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_SPECIFICATION;
+                }
+                break;
+            }
+
+            case DW_AT_sibling:
+            {
+                if (abbrev.hasChildren)
+                {
+                    attrForm.slot = FILEBIN_DWARF_SLOT_SIBLING;
+                }
+                break;
+            }
+        }
+
+        if (attrForm.slot != FILEBIN_DWARF_SLOT_NONE)
+        {
+            abbrev.hasSlots = true;
+        }
+
+        if (attrForm.fixedSize == FILEBIN_DWARF_FORM_SIZE_ADDR)
+        {
+            abbrev.addrCount++;
+        }
+        else if ((attrForm.fixedSize == FILEBIN_DWARF_FORM_SIZE_VARIABLE) || (abbrev.fixedSize < 0))
+        {
+            abbrev.fixedSize = -1;
+        }
+        else
+        {
+            abbrev.fixedSize += attrForm.fixedSize;
+        }
+    }
+}
+
+/* Fixed size readers in target byte order (chosen once per Parse) */
+template <FileBin_ByteOrder Order>
+static inline uint16_t readU16(const uint8_t*& p)
 {
-    uint16_t v = p[0] | (p[1] << 8);
+    uint16_t v = FileBin_Endian<Order>::Load16(p);
     p += 2;
     return v;
 }
 
-static uint32_t readU32(const uint8_t*& p)
+template <FileBin_ByteOrder Order>
+static inline uint32_t readU32(const uint8_t*& p)
 {
-    uint32_t v =
-        (uint32_t)p[0] |
-        ((uint32_t)p[1] << 8) |
-        ((uint32_t)p[2] << 16) |
-        ((uint32_t)p[3] << 24);
+    uint32_t v = FileBin_Endian<Order>::Load32(p);
     p += 4;
     return v;
 }
 
-inline uint64_t readU64(const uint8_t*& ptr)
+template <FileBin_ByteOrder Order>
+static inline uint64_t readU64(const uint8_t*& p)
+{
+    uint64_t v = FileBin_Endian<Order>::Load64(p);
+    p += 8;
+    return v;
+}
+
+/* Section offset of the unit format */
+template <FileBin_ByteOrder Order>
+static inline uint64_t readOffset(const uint8_t*& p, uint8_t offsetSize)
+{
+    return (offsetSize == 8) ? readU64<Order>(p) : readU32<Order>(p);
+}
+
+/* Target address of len bytes (DW_FORM_addr, DW_OP_addr operand, .debug_addr entry), 0 for sizes no target uses */
+template <FileBin_ByteOrder Order>
+static inline uint64_t loadAddr(const uint8_t* p, size_t len)
+{
+    switch (len)
+    {
+        case 1: return *p;
+        case 2: return FileBin_Endian<Order>::Load16(p);
+        case 4: return FileBin_Endian<Order>::Load32(p);
+        case 8: return FileBin_Endian<Order>::Load64(p);
+        default: return 0;
+    }
+}
+
+/* String up to its terminator, in place or in a string section */
+static inline void setCString(FileBin_DWARF_AttrValueType& attr, const uint8_t* str)
 {
-    uint64_t val = 0;
-    for (int i = 0; i < 8; ++i)
+    if (!str)
     {
-        val |= static_cast<uint64_t>(*ptr++) << (i * 8);
+        return;
     }
-    return val;
+
+    const uint8_t* end = str;
+    while (*end) ++end;
+    attr.SetBlock(FILEBIN_DWARF_ATTR_STRING, str, end - str);
 }
 
-std::vector<uint8_t> FileBin_DWARF::ReadAttributeValue(const uint8_t*& ptr, uint32_t form, uint8_t addrSize, const uint8_t* fileBase) // base of file (for .strp strings)
+template <FileBin_ByteOrder Order>
+const uint8_t* FileBin_DWARF::IndexedString(const FileBin_DWARF_CompileUnitType* cu, uint64_t index) const
 {
-    std::vector<uint8_t> data;
+    // Entry of the unit table in .debug_str_offsets, holding an offset into .debug_str (their .dwo sections for split units)
+    const FileBin_DWARF_SplitSectionsType* split = cu->Split;
+    const uint8_t* data = split ? split->Data : this->fileBase;
+    uint64_t tableOffset = split ? split->StrOffsetsOffset : this->Sections.StrOffsetsOffset;
+    uint64_t tableLen = split ? split->StrOffsetsLen : this->Sections.StrOffsetsLen;
+
+    uint64_t entry = cu->StrOffsetsBase + index * cu->OffsetSize;
+    if (entry + cu->OffsetSize > tableLen)
+    {
+        return nullptr;
+    }
 
-    switch (form)
+    const uint8_t* p = data + tableOffset + entry;
+    return data + (split ? split->StrOffset : this->StrOffset) + readOffset<Order>(p, cu->OffsetSize);
+}
+
+template <FileBin_ByteOrder Order>
+uint64_t FileBin_DWARF::IndexedAddr(const FileBin_DWARF_CompileUnitType* cu, uint64_t index) const
+{
+    // Entry of the unit table in .debug_addr, an address of the unit size
+    uint64_t entry = cu->AddrBase + index * cu->AddrSize;
+    if (entry + cu->AddrSize > this->Sections.AddrLen)
+    {
+        return 0;
+    }
+
+    return loadAddr<Order>(this->fileBase + this->Sections.AddrOffset + entry, cu->AddrSize);
+}
+
+template <FileBin_ByteOrder Order>
+FileBin_DWARF_AttrValueType FileBin_DWARF::ReadAttributeValue(const uint8_t*& ptr, const FileBin_DWARF_AbbrevAttr& attrForm, const FileBin_DWARF_CompileUnitType* cu)
+{
+    FileBin_DWARF_AttrValueType attr;
+
+    switch (attrForm.form)
     {
         case DW_FORM_string:
         {
             // null-terminated string in place
-            const uint8_t* start = ptr;
-            while (*ptr) ++ptr;
-            data.insert(data.end(), start, ptr);
-            ++ptr; // skip null terminator
+            setCString(attr, ptr);
+            ptr += attr.Len + 1; // skip null terminator
             break;
         }
 
         case DW_FORM_block1:
         {
             uint8_t blockLen = *ptr++;
-            data.insert(data.end(), ptr, ptr + blockLen);
+            attr.SetBlock(FILEBIN_DWARF_ATTR_BLOCK, ptr, blockLen);
             ptr += blockLen;
             break;
         }
 
         case DW_FORM_block2:
         {
-            uint16_t blockLen = readU16(ptr);
-            data.insert(data.end(), ptr, ptr + blockLen);
+            uint16_t blockLen = readU16<Order>(ptr);
+            attr.SetBlock(FILEBIN_DWARF_ATTR_BLOCK, ptr, blockLen);
             ptr += blockLen;
             break;
         }
 
         case DW_FORM_strp:
         {
-            uint32_t strOffset = readU32(ptr);
-            const uint8_t* strStart = fileBase + StrOffset + strOffset;
-            const uint8_t* strEnd = strStart;
-            while (*strEnd) ++strEnd;
-            data.insert(data.end(), strStart, strEnd);
+            uint64_t strOffset = readOffset<Order>(ptr, cu->OffsetSize);
+            setCString(attr, cu->Split ? (cu->Split->Data + cu->Split->StrOffset + strOffset) : (this->fileBase + StrOffset + strOffset));
             break;
         }
 
-        case DW_FORM_data1:
+        case DW_FORM_line_strp:
         {
-            data.push_back(*ptr++);
+            uint64_t strOffset = readOffset<Order>(ptr, cu->OffsetSize);
+            if (strOffset < this->Sections.LineStrLen)
+            {
+                setCString(attr, this->fileBase + this->Sections.LineStrOffset + strOffset);
+            }
             break;
         }
 
-        case DW_FORM_data2:
+        case DW_FORM_strx:
+        case DW_FORM_GNU_str_index:
         {
-            uint16_t v = readU16(ptr);
-            data.resize(2);
-            std::memcpy(data.data(), &v, 2);
+            setCString(attr, IndexedString<Order>(cu, FileBin_DWARF_ReadULEB128(ptr)));
             break;
         }
 
-        case DW_FORM_data4:
-        case DW_FORM_ref4:
+        case DW_FORM_strx1:
         {
-            uint32_t v = readU32(ptr);
-            data.resize(4);
-            std::memcpy(data.data(), &v, 4);
+            setCString(attr, IndexedString<Order>(cu, *ptr++));
+            break;
+        }
+
+        case DW_FORM_strx2:
+        {
+            setCString(attr, IndexedString<Order>(cu, readU16<Order>(ptr)));
+            break;
+        }
+
+        case DW_FORM_strx3:
+        {
+            setCString(attr, IndexedString<Order>(cu, FileBin_Endian<Order>::Load24(ptr)));
+            ptr += 3;
+            break;
+        }
+
+        case DW_FORM_strx4:
+        {
+            setCString(attr, IndexedString<Order>(cu, readU32<Order>(ptr)));
+            break;
+        }
+
+        case DW_FORM_block4:
+        {
+            uint32_t blockLen = readU32<Order>(ptr);
+            attr.SetBlock(FILEBIN_DWARF_ATTR_BLOCK, ptr, blockLen);
+            ptr += blockLen;
+            break;
+        }
+
+        case DW_FORM_data1:
+        case DW_FORM_ref1:
+        case DW_FORM_flag:
+        {
+            attr.SetConstant(*ptr++);
+            break;
+        }
+
+        case DW_FORM_data2:
+        case DW_FORM_ref2:
+        {
+            attr.SetConstant(readU16<Order>(ptr));
+            break;
+        }
+
+        case DW_FORM_data4:
+        case DW_FORM_ref4:
+        case DW_FORM_ref_sup4:
+        {
+            attr.SetConstant(readU32<Order>(ptr));
+            break;
+        }
+
+        case DW_FORM_sec_offset:
+        case DW_FORM_strp_sup:
+        case DW_FORM_GNU_ref_alt:
+        case DW_FORM_GNU_strp_alt:
+        {
+            attr.SetConstant(readOffset<Order>(ptr, cu->OffsetSize));
             break;
         }
 
         case DW_FORM_data8:
         case DW_FORM_ref8:
+        case DW_FORM_ref_sig8:
+        case DW_FORM_ref_sup8:
+        {
+            attr.SetConstant(readU64<Order>(ptr));
+            break;
+        }
+
+        case DW_FORM_data16:
         {
-            uint64_t v = readU64(ptr);
-            data.resize(8);
-            std::memcpy(data.data(), &v, 8);
+            attr.SetBlock(FILEBIN_DWARF_ATTR_BLOCK, ptr, 16);
+            ptr += 16;
             break;
         }
 
+        case DW_FORM_ref_addr:
         case DW_FORM_addr:
         {
-            if (addrSize == 8)
+            // DW_FORM_ref_addr is address sized in DWARF 2, offset sized since DWARF 3
+            if ((attrForm.form == DW_FORM_ref_addr) && (cu->Version > 2))
             {
-                uint64_t v = readU64(ptr);
-                data.resize(8);
-                std::memcpy(data.data(), &v, 8);
+                attr.SetConstant(readOffset<Order>(ptr, cu->OffsetSize));
+                break;
             }
-            else
+
+            // 8 and 16-bit targets included, any other size leaves the value unreadable: stop at the end of the unit
+            switch (cu->AddrSize)
             {
-                uint32_t v = readU32(ptr);
-                data.resize(4);
-                std::memcpy(data.data(), &v, 4);
+                case 1:
+                case 2:
+                case 4:
+                case 8:
+                    attr.SetConstant(loadAddr<Order>(ptr, cu->AddrSize));
+                    ptr += cu->AddrSize;
+                    break;
+
+                default:
+                    std::cerr << "[ERROR] Unsupported address size: " << cu->AddrSize << "\n";
+                    ptr = cu->Data + cu->FileOffset + cu->Size();
+                    break;
             }
             break;
         }
 
+        case DW_FORM_addrx:
+        case DW_FORM_GNU_addr_index:
+        {
+            attr.SetConstant(IndexedAddr<Order>(cu, FileBin_DWARF_ReadULEB128(ptr)));
+            break;
+        }
+
+        case DW_FORM_addrx1:
+        {
+            attr.SetConstant(IndexedAddr<Order>(cu, *ptr++));
+            break;
+        }
+
+        case DW_FORM_addrx2:
+        {
+            attr.SetConstant(IndexedAddr<Order>(cu, readU16<Order>(ptr)));
+            break;
+        }
+
+        case DW_FORM_addrx3:
+        {
+            attr.SetConstant(IndexedAddr<Order>(cu, FileBin_Endian<Order>::Load24(ptr)));
+            ptr += 3;
+            break;
+        }
+
+        case DW_FORM_addrx4:
+        {
+            attr.SetConstant(IndexedAddr<Order>(cu, readU32<Order>(ptr)));
+            break;
+        }
+
         case DW_FORM_udata:
+        case DW_FORM_ref_udata:
         {
-            uint64_t v = FileBin_DWARF_ReadULEB128(ptr);
-            do {
-                data.push_back(static_cast<uint8_t>(v & 0xFF));
-                v >>= 8;
-            } while (v);
+            attr.SetConstant(FileBin_DWARF_ReadULEB128(ptr));
             break;
         }
 
         case DW_FORM_sdata:
         {
-            int64_t v = FileBin_DWARF_ReadSLEB128(ptr);
-            data.resize(sizeof(v));
-            std::memcpy(data.data(), &v, sizeof(v));
+            attr.SetConstant(static_cast<uint64_t>(FileBin_DWARF_ReadSLEB128(ptr)));
             break;
         }
 
-        case DW_FORM_sec_offset:
+        case DW_FORM_implicit_const:
         {
-            uint32_t v = readU32(ptr);
-            data = { static_cast<uint8_t>(v & 0xFF),
-                    static_cast<uint8_t>((v >> 8) & 0xFF),
-                    static_cast<uint8_t>((v >> 16) & 0xFF),
-                    static_cast<uint8_t>((v >> 24) & 0xFF) };
+            attr.SetConstant(static_cast<uint64_t>(attrForm.implicitConst));
             break;
         }
 
+        case DW_FORM_block:
         case DW_FORM_exprloc:
         {
             uint64_t len = FileBin_DWARF_ReadULEB128(ptr);
-            data.insert(data.end(), ptr, ptr + len);
+            attr.SetBlock(FILEBIN_DWARF_ATTR_BLOCK, ptr, len);
             ptr += len;
             break;
         }
 
-        case DW_FORM_ref_udata:
+        case DW_FORM_flag_present:
         {
-            uint64_t len = FileBin_DWARF_ReadULEB128(ptr);
-            //data.insert(data.end(), ptr, ptr + len);
-            //ptr += len;
+            attr.SetConstant(1);
+            break;
         }
 
-        case DW_FORM_flag:
+        case DW_FORM_indirect:
         {
-            data.push_back(*ptr++);
+            // Actual form precedes the value
+            FileBin_DWARF_AbbrevAttr indirect = attrForm;
+            indirect.form = FileBin_DWARF_ReadULEB128(ptr);
+            if (indirect.form != DW_FORM_indirect)
+            {
+                attr = ReadAttributeValue<Order>(ptr, indirect, cu);
+            }
             break;
         }
 
-        case DW_FORM_flag_present:
+        default:
+        {
+            // Size unknown, nothing after it can be decoded: stop at the end of the unit
+            std::cerr << "[ERROR] Unsupported DW_FORM: " << attrForm.form << "\n";
+            ptr = cu->Data + cu->FileOffset + cu->Size();
+            break;
+        }
+    }
+
+    return attr;
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::SkipAttributeValue(const uint8_t*& ptr, const FileBin_DWARF_AbbrevAttr& attrForm, const FileBin_DWARF_CompileUnitType* cu)
+{
+    if (attrForm.fixedSize >= 0)
+    {
+        ptr += attrForm.fixedSize;
+        return;
+    }
+
+    if (attrForm.fixedSize == FILEBIN_DWARF_FORM_SIZE_ADDR)
+    {
+        ptr += cu->AddrSize;
+        return;
+    }
+
+    switch (attrForm.form)
+    {
+        case DW_FORM_string:
+        {
+            ptr += std::strlen(reinterpret_cast<const char*>(ptr)) + 1;
+            break;
+        }
+
+        case DW_FORM_block1:
+        {
+            uint8_t blockLen = *ptr++;
+            ptr += blockLen;
+            break;
+        }
+
+        case DW_FORM_block2:
+        {
+            uint16_t blockLen = readU16<Order>(ptr);
+            ptr += blockLen;
+            break;
+        }
+
+        case DW_FORM_block4:
+        {
+            uint32_t blockLen = readU32<Order>(ptr);
+            ptr += blockLen;
+            break;
+        }
+
+        case DW_FORM_block:
+        case DW_FORM_exprloc:
+        {
+            uint64_t blockLen = FileBin_DWARF_ReadULEB128(ptr);
+            ptr += blockLen;
+            break;
+        }
+
+        case DW_FORM_udata:
+        case DW_FORM_sdata:
+        case DW_FORM_ref_udata:
+        case DW_FORM_strx:
+        case DW_FORM_addrx:
+        case DW_FORM_GNU_str_index:
+        case DW_FORM_GNU_addr_index:
         {
-            data.push_back(1);
+            FileBin_LEB128_Skip(ptr);
             break;
         }
 
         default:
         {
-            std::cerr << "[ERROR] Unsupported DW_FORM: " << form << "\n";
+            // Less common forms go through the full decoder
+            ReadAttributeValue<Order>(ptr, attrForm, cu);
             break;
         }
     }
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::SkipDIE(const uint8_t*& ptr, const uint8_t* sectionEnd, FileBin_DWARF_CompileUnitType* cu)
+{
+    /* Walks a sibling list and all its descendants without building nodes, stops after its terminating 0 */
+    uint32_t depth = 0;
+
+    while (ptr < sectionEnd)
+    {
+        uint64_t abbrevCode = FileBin_DWARF_ReadULEB128(ptr);
+        if (abbrevCode == 0)
+        {
+            if (depth == 0)
+            {
+                break;
+            }
+            depth--;
+            continue;
+        }
+
+        const FileBin_DWARF_Abbrev* abbrev = cu->AbbrevInfo->Find(abbrevCode);
+        if (!abbrev)
+        {
+            std::cerr << "[WARNING] Abbrev code " << abbrevCode << " not found\n";
+            ptr = sectionEnd;
+            break;
+        }
+
+        if (abbrev->fixedSize >= 0)
+        {
+            ptr += abbrev->fixedSize + abbrev->addrCount * cu->AddrSize;
+        }
+        else
+        {
+            for (const FileBin_DWARF_AbbrevAttr& attrForm : abbrev->attributes)
+            {
+                SkipAttributeValue<Order>(ptr, attrForm, cu);
+            }
+        }
 
-    return data;
+        if (abbrev->hasChildren)
+        {
+            depth++;
+        }
+    }
 }
 
-TreeElementType* FileBin_DWARF::ParseDIE(const uint8_t*& ptr, const uint8_t* fileBase, uint32_t cuOffset, uint32_t infoLen, FileBin_DWARF_CompileUnitType* cu, TreeElementType* parent)
+template <FileBin_ByteOrder Order>
+uint32_t FileBin_DWARF::ParseDIE(const uint8_t*& ptr, const uint8_t* fileBase, uint64_t cuOffset, uint64_t cuSize, FileBin_DWARF_CompileUnitType* cu, uint32_t parent, bool lazy)
 {
-    TreeElementType* prev = nullptr;
-    const uint8_t* sectionEnd = fileBase + cuOffset + infoLen;
-    uint32_t CurrentAbbrevOffset2;
+    FileBin_DIEStore& dies = cu->Dies;
+    uint32_t first = FILEBIN_DIESTORE_NONE;
+    uint32_t prev = FILEBIN_DIESTORE_NONE;
+    const uint8_t* sectionEnd = fileBase + cuOffset + cuSize;
+    const uint8_t* unitBase = fileBase + cuOffset;
 
     while (ptr < sectionEnd)
     {
-        const uint8_t* dieStart = ptr;
-        // Set CurrentAbbrevOffset to the offset of this DIE relative to the CU start
-        CurrentAbbrevOffset2 = static_cast<uint32_t>(dieStart - fileBase);
+        // Offset of this DIE relative to the CU start, the key DW_AT_type references use
+        uint32_t dieOffset = static_cast<uint32_t>(ptr - unitBase);
 
         uint64_t abbrevCode = FileBin_DWARF_ReadULEB128(ptr);
         if (abbrevCode == 0)
             break; // end of siblings
 
-        auto it = cu->AbbrevInfo->abbrevTable.find(static_cast<uint32_t>(abbrevCode));
-        if (it == cu->AbbrevInfo->abbrevTable.end())
+        const FileBin_DWARF_Abbrev* abbrev = cu->AbbrevInfo->Find(abbrevCode);
+        if (!abbrev)
         {
             std::cerr << "[WARNING] Abbrev code " << abbrevCode << " not found\n";
             break;
         }
 
-        FileBin_DWARF_Abbrev& abbrev = it->second;
+        uint32_t node = dies.Append(static_cast<uint8_t>(abbrev->elementType), parent);
+
+        if (abbrev->isType)
+        {
+            cu->typeList.emplace(dieOffset, node);
+        }
 
-        TreeElementType* node = new TreeElementType();
-        node->cu = cu;
+        const uint8_t* sibling = nullptr;
 
-        // Parse attributes
-        for (const FileBin_DWARF_AbbrevAttr& attrForm : abbrev.attributes)
+        if (!abbrev->hasSlots && (abbrev->fixedSize >= 0))
         {
-            std::vector<uint8_t> data;
-            //int16_t attrSize = FileBin_DWARF::DW_FORM_GetLength(attrForm.form);
+            // Nothing to decode, step over the whole DIE at once
+            ptr += abbrev->fixedSize + abbrev->addrCount * cu->AddrSize;
+        }
+        else
+        {
+            // Parse attributes
+            for (const FileBin_DWARF_AbbrevAttr& attrForm : abbrev->attributes)
+            {
 #if (1 == LIBPARSER_DWARF_DEBUG)
-            std::cout << "  Attr: " << FileBin_DWARF_DW_AT_ToString(attrForm.attribute)
-                      << " Form: " << FileBin_DWARF_DW_FORM_ToString(attrForm.form)
-                      << std::endl;
+                std::cout << "  Attr: " << FileBin_DWARF_DW_AT_ToString(attrForm.attribute)
+                          << " Form: " << FileBin_DWARF_DW_FORM_ToString(attrForm.form)
+                          << std::endl;
 #endif
-            data = ReadAttributeValue(ptr, attrForm.form, cu->AddrSize, fileBase);
-
-            switch (abbrev.tag)
-            {
-
-                /* Compile Unit information stores at a different class than the rest of attributes */
-                case DW_TAG_compile_unit:
+                if (attrForm.slot == FILEBIN_DWARF_SLOT_NONE)
                 {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_COMPILE_UNIT;
-
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_name:
-                        {
-                            node->data = data;
-                            break;
-                        }
-                    }
-                    break;
+                    SkipAttributeValue<Order>(ptr, attrForm, cu);
+                    continue;
                 }
 
-                case DW_TAG_enumeration_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_ENUMERATION;
-
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
+                FileBin_DWARF_AttrValueType attr = ReadAttributeValue<Order>(ptr, attrForm, cu);
 
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
+                switch (attrForm.slot)
+                {
+                    case FILEBIN_DWARF_SLOT_NAME:
                     {
-                        cu->typeList.emplace(typeOffset, node);
+                        dies.NameId[node] = this->Names.Intern(attr.String());
+                        break;
                     }
 
-                    switch (attrForm.attribute)
+                    case FILEBIN_DWARF_SLOT_TYPE:
                     {
-                        case DW_AT_name:
+                        // DW_FORM_ref_addr is relative to .debug_info and DW_FORM_ref_sig8 names a type unit (all unit
+                        // headers are read before any DIE), both may lead into another unit (LTO, type units)
+                        uint64_t typeOffset = attr.Value;
+                        bool unitRelative = true;
+
+                        if (attrForm.form == DW_FORM_ref_addr)
                         {
-                            node->data = data;
-                            break;
+                            unitRelative = false;
                         }
-
-                        case DW_AT_byte_size:
+                        else if (attrForm.form == DW_FORM_ref_sig8)
                         {
-                            node->Size.push_back(data[0]);
-                            break;
+                            auto typeUnit = this->TypeUnits.find(attr.Value);
+                            if (typeUnit == this->TypeUnits.end())
+                            {
+                                break;
+                            }
+
+                            typeOffset = typeUnit->second->Offset + typeUnit->second->TypeDieOffset;
+                            unitRelative = false;
                         }
-                    }
-                    break;
-                }
 
-                case DW_TAG_enumerator:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_ENUMERATION;
+                        if (!unitRelative && (typeOffset - cu->Offset >= cuSize))
+                        {
+                            dies.Flags[node] |= FILEBIN_DIESTORE_FLAG_TYPE_REF;
+                            cu->typeRefs[node] = typeOffset;
 
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_name:
+                            // The row only tells a type is present, offsets past 32 bits must not wrap to 0
+                            typeOffset = std::min<uint64_t>(typeOffset, UINT32_MAX);
+                        }
+                        else
                         {
-                            node->data = data;
-                            break;
+                            typeOffset -= unitRelative ? 0 : cu->Offset;
+                            dies.Flags[node] &= ~FILEBIN_DIESTORE_FLAG_TYPE_REF;
                         }
-                    }
-                    break;
-                }
-
-                case DW_TAG_volatile_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_VOLATILE;
 
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
+                        dies.TypeOffset[node] = static_cast<uint32_t>(typeOffset);
+                        break;
+                    }
 
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
+                    case FILEBIN_DWARF_SLOT_BYTE_SIZE:
+                    case FILEBIN_DWARF_SLOT_COUNT:
                     {
-                        cu->typeList.emplace(typeOffset, node);
+                        dies.AddDim(node, static_cast<uint32_t>(attr.Value));
+                        break;
                     }
 
-                    switch (attrForm.attribute)
+                    case FILEBIN_DWARF_SLOT_ENCODING:
                     {
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
+                        dies.Encoding[node] = static_cast<uint8_t>(attr.Value);
+                        break;
                     }
-                    break;
-                }
-
-                case DW_TAG_array_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_ARRAY;
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;// - CU_HEADER_SIZE;
 
-                    // std::cout << "ARRAY OFF " << typeOffset << std::endl;
-
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it != cu->typeList.end())
+                    case FILEBIN_DWARF_SLOT_UPPER_BOUND:
                     {
-                        //typeNode = it->second;  // reuse already parsed type
-                    } else {
-                        cu->typeList.emplace(typeOffset, node); // reserve slot
+                        // Convert Upper Bound to Count
+                        dies.AddDim(node, static_cast<uint32_t>(attr.Value) + 1);
+                        break;
                     }
 
-                    switch (attrForm.attribute)
+                    case FILEBIN_DWARF_SLOT_MEMBER_LOCATION:
                     {
-                        case DW_AT_type:
+                        if (attr.Class == FILEBIN_DWARF_ATTR_BLOCK)
+                        {
+                            // DWARF 2 style location expression: DW_OP_plus_uconst <offset>
+                            const uint8_t* expr = attr.Data;
+                            dies.Location[node] = ((attr.Len > 1) && (*expr++ == DW_OP_plus_uconst)) ? static_cast<uint32_t>(FileBin_DWARF_ReadULEB128(expr)) : 0;
+                        }
+                        else
                         {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
+                            dies.Location[node] = static_cast<uint32_t>(attr.Value);
                         }
+                        break;
                     }
-                    break;
-                }
-
-                case DW_TAG_subrange_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_ARRAY_DIM;
 
-                    switch (attrForm.attribute)
+                    case FILEBIN_DWARF_SLOT_LOCATION:
                     {
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                        case DW_AT_count:
+                        // DW_OP_addr followed by the address in target byte order, or DW_OP_addrx and its .debug_addr index
+                        if ((attr.Len > 1) && (attr.Data[0] == DW_OP_addr))
                         {
-                            uint32_t Size = 0;
-
-                            for (size_t i = 0; i < data.size(); ++i)
-                                Size += static_cast<uint32_t>(data[i]) << (i * 8);
-
-                            // std::cout << "dim coun t "<< (int)Size << std::endl;
-
-                            node->Size.push_back(Size);
-                            break;
+                            dies.Addr[node] = loadAddr<Order>(attr.Data + 1, attr.Len - 1);
                         }
-                        case DW_AT_upper_bound:
+                        else if ((attr.Len > 1) && ((attr.Data[0] == DW_OP_addrx) || (attr.Data[0] == DW_OP_GNU_addr_index)))
                         {
-                            uint32_t val = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                val += static_cast<uint32_t>(data[i]) << (i * 8);
-
-                            // Convert Upper Bound to Count
-                            node->Size.push_back(val + 1);
-                            break;
+                            const uint8_t* expr = attr.Data + 1;
+                            dies.Addr[node] = IndexedAddr<Order>(cu, FileBin_DWARF_ReadULEB128(expr));
                         }
+                        break;
                     }
-                    break;
-                }
-
-                case DW_TAG_typedef:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_TYPEDEF;
-
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
 
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
+                    case FILEBIN_DWARF_SLOT_DECLARATION:
                     {
-                        cu->typeList.emplace(typeOffset, node);
+                        dies.Flags[node] |= FILEBIN_DIESTORE_FLAG_DECLARATION;
+                        break;
                     }
 
-                    switch (attrForm.attribute)
+                    case FILEBIN_DWARF_SLOT_SPECIFICATION:
                     {
-                        case DW_AT_type:
+                        // A declaration of another unit is only known once all units are decoded, see SymbolTraverse()
+                        uint64_t declOffset = attr.Value;
+                        if (attrForm.form == DW_FORM_ref_addr)
                         {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
+                            if (declOffset - cu->Offset >= cuSize)
+                            {
+                                dies.Flags[node] |= FILEBIN_DIESTORE_FLAG_ORIGIN_REF;
+                                cu->originRefs[node] = declOffset;
+                                break;
+                            }
+                            declOffset -= cu->Offset;
                         }
-                    }
-                    break;
-                }
 
-                case DW_TAG_base_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_BASE_TYPE;
+                        // If this is a definition, DW_AT_specification points to the declaration
+                        auto it = cu->varList.find(static_cast<uint32_t>(declOffset));
 
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
+                        if (it != cu->varList.end())
+                        {
+                            uint32_t declNode = it->second;
 
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
-                    {
-                        cu->typeList.emplace(typeOffset, node);
-                    }
+                            // Copy relevant info from declaration
+                            if (dies.NameId[node] == 0)
+                                dies.NameId[node] = dies.NameId[declNode];
 
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_name:
-                        {
-                            node->data = data;
-                            break;
-                        }
+                            if (dies.TypeOffset[node] == 0)
+                            {
+                                dies.TypeOffset[node] = dies.TypeOffset[declNode];
+
+                                if (dies.Flags[declNode] & FILEBIN_DIESTORE_FLAG_TYPE_REF)
+                                {
+                                    uint64_t typeOffset = cu->typeRefs[declNode];
+                                    dies.Flags[node] |= FILEBIN_DIESTORE_FLAG_TYPE_REF;
+                                    cu->typeRefs[node] = typeOffset;
+                                }
+                            }
 
-                        case DW_AT_byte_size:
-                        {
-                            node->Size.push_back(data[0]);
-                            break;
+                            if (dies.Addr[node] == 0)
+                                dies.Addr[node] = dies.Addr[declNode];
                         }
+                        break;
                     }
-                    break;
-                }
-
-                case DW_TAG_structure_type:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_STRUCTURE;
-
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
 
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
+                    case FILEBIN_DWARF_SLOT_SIBLING:
                     {
-                        cu->typeList.emplace(typeOffset, node);
+                        sibling = fileBase + cuOffset + attr.Value;
+                        break;
                     }
 
-                    switch (attrForm.attribute)
+                    default:
                     {
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                        case DW_AT_byte_size:
-                        {
-                            uint32_t Size = 0;
-
-                            for (size_t i = 0; i < data.size(); ++i)
-                                Size += static_cast<uint32_t>(data[i]) << (i * 8);
-
-                            // std::cout << "dim coun t "<< (int)Size << std::endl;
-
-                            node->Size.push_back(Size);
-                        }
+                        break;
                     }
-                    break;
                 }
+            }
+        }
 
-                case DW_TAG_member:
-                {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_MEMBER;
-
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
-
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
-                    {
-                        cu->typeList.emplace(typeOffset, node);
-                    }
+        // Variables without a location (declarations, abstract instances) are what a definition can complete
+        if ((abbrev->tag == DW_TAG_variable) && (dies.Addr[node] == 0))
+        {
+            cu->varList.emplace(dieOffset, node);
+        }
 
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_name:
-                        {
-                            node->data = data;
-                            break;
-                        }
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                        case DW_AT_data_member_location:
-                        {
-                            node->Location = 0;
-
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->Location += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                    }
-                    break;
+        // Recurse into children, or jump over subtrees nothing is taken from (or not asked for yet)
+        if (abbrev->hasChildren)
+        {
+            if (!abbrev->skipChildren && !lazy)
+            {
+                ParseDIE<Order>(ptr, fileBase, cuOffset, cuSize, cu, node, false);
+            }
+            else
+            {
+                if (!abbrev->skipChildren)
+                {
+                    dies.SetPending(node, ptr);
                 }
 
-                case DW_TAG_variable:
+                if (parent == 0)
                 {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_VARIABLE;
-
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_name:
-                        {
-                            node->data = data;
-
-                            break;
-                        }
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                        case DW_AT_location:
-                        {
-                            node->Addr = 0;
-                            for (size_t i = 1; i < data.size(); ++i)
-                            {
-                                node->Addr += static_cast<uint32_t>(data[i]) << ((i - 1) * 8);
-                            }
-                            break;
-                        }
-                        case DW_AT_declaration:
-                        {
-                            node->isDeclaration = true;
-                            uint32_t dieOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
-                            cu->varDeclaration.emplace(dieOffset, node);
-                            break;
-                        }
-
-                        case DW_AT_specification:
-                        {
-                            // If this is a definition, DW_AT_specification points to the declaration
-                            uint32_t specOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                            {
-                                specOffset |= static_cast<uint32_t>(data[i]) << (8 * i);
-                            }
-
-                            auto it = cu->varDeclaration.find(specOffset);
-
-                            if (it != cu->varDeclaration.end())
-                            {
-                                TreeElementType* declNode = it->second;
-
-                                // Copy relevant info from declaration
-                                if (node->data.empty())
-                                    node->data = declNode->data;
-
-                                if (node->typeOffset == 0)
-                                    node->typeOffset = declNode->typeOffset;
-
-                                node->Addr = declNode->Addr;
-                            }
-                            break;
-                        }
-                    }
-                    break;
+                    // Nothing follows the unit DIE, no need to find the end of its children
                 }
-
-                case DW_TAG_const_type:
+                else if (sibling && (sibling > ptr) && (sibling <= sectionEnd))
                 {
-                    node->elementType = FILEBIN_DWARF_ELEMENT_CONSTANT;
-                    uint32_t typeOffset = CurrentAbbrevOffset2 - cu->Offset - InfoOffset;
-
-                    auto it = cu->typeList.find(typeOffset);
-                    if (it == cu->typeList.end())
-                    {
-                        cu->typeList.emplace(typeOffset, node);
-                    }
-
-                    switch (attrForm.attribute)
-                    {
-                        case DW_AT_type:
-                        {
-                            node->typeOffset = 0;
-                            for (size_t i = 0; i < data.size(); ++i)
-                                node->typeOffset += static_cast<uint32_t>(data[i]) << (i * 8);
-                            break;
-                        }
-                    }
-                    break;
+                    ptr = sibling;
                 }
-
-                default:
+                else
                 {
-                    //std::cerr << "Unknown DW_TAG " << (int)abbrev.tag << std::endl;
-                    break;
+                    SkipDIE<Order>(ptr, sectionEnd, cu);
                 }
             }
         }
 
-        // Recurse into children
-        if (abbrev.hasChildren)
-            node->child = ParseDIE(ptr, fileBase, cuOffset, infoLen, cu, node);
-
         // Sibling linkage
-        if (prev)
+        if (prev != FILEBIN_DIESTORE_NONE)
         {
-            prev->next = node;
+            dies.Sibling[prev] = node;
         }
-        else if (parent)
+        else
         {
-            parent->child = node;
+            first = node;
+            if (parent != FILEBIN_DIESTORE_NONE)
+            {
+                dies.FirstChild[parent] = node;
+            }
         }
 
         prev = node;
+
+        // A unit holds a single top-level DIE
+        if (parent == 0)
+        {
+            break;
+        }
     }
 
-    return parent ? parent->child : prev;
+    return first;
 }
 
-uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_VarInfoType* parent)
+/* .debug_info offset of the type DIE of a row, whichever unit holds it */
+static inline uint64_t typeTarget(FileBin_DWARF_DieCursor node)
+{
+    return node.IsTypeRef() ? node.Unit->typeRefs.at(node.Row) : node.Unit->Offset + node.TypeOffset();
+}
+
+uint32_t FileBin_DWARF::SymbolResolveType(FileBin_DWARF_SymbolScopeType& scope, FileBin_DWARF_DieCursor node, FileBin_DWARF_VarInfoType* parent)
 {
     FileBin_DWARF_VarInfoType* newVar = nullptr;
-    uint8_t symbolSize = 0;
+    uint32_t symbolSize = 0;
     uint32_t elementSize = 0;
 
-    if (node->elementType == FILEBIN_DWARF_ELEMENT_BASE_TYPE)
+    if (node.Tag() == FILEBIN_DWARF_ELEMENT_BASE_TYPE)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = node->data;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = node.NameId();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
 
-        std::string str(newVar->data.begin(), newVar->data.end());
+        newVar->DataType = FileBin_DWARF_BaseTypeClassify(node.Encoding(), node.Dim(0));
 
-        if (str == "unsigned char" || str == "char")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_UINT8;
-        }
-        else if (str == "signed char")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_SINT8;
-        }
-        else if (str == "unsigned short" || str == "short unsigned int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_UINT16;
-        }
-        else if (str == "short" || str == "short int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_SINT16;
-        }
-        else if (str == "unsigned long" || str == "long unsigned int" || str == "unsigned int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_UINT32;
-        }
-        else if (str == "long" || str == "long int" || str == "int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_SINT32;
-        }
-        else if (str == "unsigned long long" || str == "long long unsigned int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_UINT64;
-        }
-        else if (str == "long long" || str == "long long int")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_SINT64;
-        }
-        else if (str == "float")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_FLOAT32;
-        }
-        else if (str == "double")
-        {
-            newVar->DataType = FileBin_VARINFO_TYPE_FLOAT64;
-        }
-        else
+        if (newVar->DataType == FileBin_VARINFO_TYPE__UNKNOWN)
         {
-            std::cerr << "Unknown type " + str + "\n";
-            newVar->DataType = FileBin_VARINFO_TYPE__UNKNOWN;
+            // Names.Get() must not run while other workers intern, the unit offset and encoding point at the DIE
+            std::cerr << "Unknown type encoding 0x" << std::hex << static_cast<uint32_t>(node.Encoding())
+                      << " in unit at 0x" << scope.Unit->Offset << std::dec << "\n";
         }
 
         /* Propagate type */
         parent->DataType = newVar->DataType;
 
-        if (node->Size.size() > 0)
+        if (node.DimCount() > 0)
         {
-            symbolSize = node->Size.at(0);
+            symbolSize = node.Dim(0);
             newVar->Size.push_back(symbolSize);
             parent->Size = newVar->Size;
         }
@@ -1273,13 +1599,13 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             last->next = newVar;
         }
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_CONSTANT)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_CONSTANT)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'C', 'O', 'N'};
-        newVar->TypeOffset = node->typeOffset;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->ConstLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
 
         // Append to parent's child list
         if (!parent->child)
@@ -1296,30 +1622,25 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
         /* Propagate type */
         //parent->DataType = newVar->DataType;
 
-        // Lookup type in CU typeList
-        if ((node->cu)&&(newVar->TypeOffset != 0))
+        // Attach the shared layout of the qualified type
+        const FileBin_DWARF_TypeLayoutType* layout = (newVar->TypeOffset != 0) ? SymbolAttachType(scope, typeTarget(node), newVar) : nullptr;
+        if (layout)
         {
-            auto it = node->cu->typeList.find(node->typeOffset);
-            if (it != node->cu->typeList.end())
-            {
-                TreeElementType* typeNode = it->second;
-                // Recursively traverse the type tree and attach as child
-                symbolSize += SymbolResolveType(typeNode, newVar);
-                // Propagate dimension definition
-                /* Propagate type */
-                parent->DataType = newVar->DataType;
-                parent->Size = newVar->Size;
-                //newVar->Size.push_back(symbolSize);
-            }
+            symbolSize += layout->SymbolSize;
+            // Propagate dimension definition
+            /* Propagate type */
+            parent->DataType = newVar->DataType;
+            parent->Size = newVar->Size;
+            //newVar->Size.push_back(symbolSize);
         }
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_VOLATILE)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_VOLATILE)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'V', 'O', 'L', 'A', 'T', 'I', 'L', 'E'};
-        newVar->TypeOffset = node->typeOffset;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->VolatileLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
         // Append to parent's child list
         if (!parent->child)
         {
@@ -1332,28 +1653,24 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             last->next = newVar;
         }
 
-        // Lookup type in CU typeList
-        if (node->cu && (newVar->TypeOffset != 0))
+        // Attach the shared layout of the qualified type
+        const FileBin_DWARF_TypeLayoutType* layout = (newVar->TypeOffset != 0) ? SymbolAttachType(scope, typeTarget(node), newVar) : nullptr;
+        if (layout)
         {
-            auto it = node->cu->typeList.find(node->typeOffset);
-            if (it != node->cu->typeList.end())
-            {
-                // Recursively traverse the type tree and attach as child
-                symbolSize += SymbolResolveType(it->second, newVar);
+            symbolSize += layout->SymbolSize;
 
-                /* Propagate type */
-                parent->DataType = newVar->DataType;
-                parent->Size = newVar->Size;
-            }
+            /* Propagate type */
+            parent->DataType = newVar->DataType;
+            parent->Size = newVar->Size;
         }
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_TYPEDEF)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_TYPEDEF)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'T', 'I', 'P'};
-        newVar->TypeOffset = node->typeOffset;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->PointerLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
 
         // Append to parent's child list
         if (!parent->child)
@@ -1367,28 +1684,24 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             last->next = newVar;
         }
 
-        // Lookup type in CU typeList
-        if ((node->cu)&&(newVar->TypeOffset != 0))
+        // Attach the shared layout of the aliased type
+        const FileBin_DWARF_TypeLayoutType* layout = (newVar->TypeOffset != 0) ? SymbolAttachType(scope, typeTarget(node), newVar) : nullptr;
+        if (layout)
         {
-            auto it = node->cu->typeList.find(node->typeOffset);
-            if (it != node->cu->typeList.end())
-            {
-                TreeElementType* typeNode = it->second;
-                symbolSize += SymbolResolveType(typeNode, newVar);
-                /* Propagate type */
-                parent->DataType = newVar->DataType;
-                parent->Size = newVar->Size;
-            }
+            symbolSize += layout->SymbolSize;
+            /* Propagate type */
+            parent->DataType = newVar->DataType;
+            parent->Size = newVar->Size;
         }
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_STRUCTURE)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_STRUCTURE)
     {
         uint8_t structTotalSize = 0;
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'S', 'T', 'R'};
-        newVar->TypeOffset = node->typeOffset;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->StructLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
 
         // Append to parent's child list
         if (!parent->child)
@@ -1396,55 +1709,59 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             parent->child = newVar;
         }
 
-        TreeElementType* nodeMember = node->child;
+        FileBin_DWARF_DieCursor nodeMember = node.Child();
         FileBin_DWARF_VarInfoType* newNodeMember = parent->child;
 
         // Only create child if nodeMember exists
-        if (nodeMember != nullptr)
+        if (nodeMember.Valid())
         {
-            newNodeMember->child = new FileBin_DWARF_VarInfoType();
+            newNodeMember->child = NewVarInfo(scope.Arena);
             newNodeMember = newNodeMember->child;
         }
 
-        while (nodeMember != nullptr)
+        while (nodeMember.Valid())
         {
-            newNodeMember->data = nodeMember->data;
+            newNodeMember->nameId = nodeMember.NameId();
+            newNodeMember->elementType = FILEBIN_DWARF_ELEMENT_MEMBER;
 
-            if ((nodeMember->cu) && (nodeMember->typeOffset != 0))
+            if (nodeMember.TypeOffset() != 0)
             {
-                auto it = nodeMember->cu->typeList.find(nodeMember->typeOffset);
-                if (it != nodeMember->cu->typeList.end())
+                const FileBin_DWARF_TypeLayoutType* layout = SymbolAttachType(scope, typeTarget(nodeMember), newNodeMember);
+                if (layout)
                 {
-                    TreeElementType* typeNode = it->second;
-                    newNodeMember->Addr = parent->Addr + nodeMember->Location;
-                    elementSize = SymbolResolveType(typeNode, newNodeMember);
+                    // Member address is kept relative to the structure
+                    newNodeMember->Addr = nodeMember.Location();
+                    elementSize = layout->SymbolSize;
                     symbolSize += elementSize;
                 }
             }
 
 
             // Only create next node if there is actually a next node
-            if (nodeMember->next != nullptr)
+            if (nodeMember.Next().Valid())
             {
-                newNodeMember->next = new FileBin_DWARF_VarInfoType();
+                newNodeMember->next = NewVarInfo(scope.Arena);
                 newNodeMember = newNodeMember->next;
             }
 
-            nodeMember = nodeMember->next;
+            nodeMember = nodeMember.Next();
         }
 
         //newVar->Size.push_back(symbolSize);
-        newVar->Size = node->Size;
-        symbolSize = node->Size.at(0);
-        parent->Size = node->Size;
+        for (uint32_t i = 0; i < node.DimCount(); i++)
+        {
+            newVar->Size.push_back(node.Dim(i));
+        }
+        symbolSize = node.Dim(0);
+        parent->Size = newVar->Size;
 
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_ENUMERATION)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_ENUMERATION)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'E', 'N', 'U'};
-        newVar->TypeOffset = node->typeOffset;
-        newVar->Addr = parent->Addr;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->EnumLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
 
         parent->DataType = FileBin_VARINFO_TYPE_ENUM;
@@ -1455,36 +1772,36 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             parent->child = newVar;
         }
 
-        TreeElementType* nodeMember = node->child;
+        FileBin_DWARF_DieCursor nodeMember = node.Child();
         FileBin_DWARF_VarInfoType* newNodeMember =  parent->child;
 
-        newNodeMember->child = new FileBin_DWARF_VarInfoType();
+        newNodeMember->child = NewVarInfo(scope.Arena);
         newNodeMember = newNodeMember->child;
 
-        while (nodeMember != nullptr)
+        while (nodeMember.Valid())
         {
-            newNodeMember->data = nodeMember->data;
+            newNodeMember->nameId = nodeMember.NameId();
             newNodeMember->isQualifier = true;
 
-            if (nodeMember->next != nullptr)
+            if (nodeMember.Next().Valid())
             {
-                newNodeMember->next = new FileBin_DWARF_VarInfoType();
+                newNodeMember->next = NewVarInfo(scope.Arena);
                 newNodeMember = newNodeMember->next;
             }
 
-            nodeMember = nodeMember->next;
+            nodeMember = nodeMember.Next();
         }
-        if (node->Size.size() > 0)
+        if (node.DimCount() > 0)
         {
-            parent->Size.push_back(node->Size.at(0));
+            parent->Size.push_back(node.Dim(0));
         }
     }
-    else if (node->elementType == FILEBIN_DWARF_ELEMENT_ARRAY)
+    else if (node.Tag() == FILEBIN_DWARF_ELEMENT_ARRAY)
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'A', 'R', 'R'};
-        newVar->TypeOffset = node->typeOffset;
-        newVar->Addr = parent->Addr;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->ArrayLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
 
         // Append to parent's child list
@@ -1493,41 +1810,37 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
             parent->child = newVar;
         }
 
-        TreeElementType* nodeMember = node->child;
+        FileBin_DWARF_DieCursor nodeMember = node.Child();
 
-        while (nodeMember != nullptr)
+        while (nodeMember.Valid())
         {
-            if (nodeMember->Size.size() > 0)
+            if (nodeMember.DimCount() > 0)
             {
-                newVar->Size.push_back(nodeMember->Size.at(0));
-                parent->Size.push_back(nodeMember->Size.at(0));
+                newVar->Size.push_back(nodeMember.Dim(0));
+                parent->Size.push_back(nodeMember.Dim(0));
             }
-            nodeMember = nodeMember->next;
+            nodeMember = nodeMember.Next();
         }
 
-        // Lookup type in CU typeList
-        if ((node->cu)&&(newVar->TypeOffset != 0))
+        // Attach the shared layout of the element type
+        const FileBin_DWARF_TypeLayoutType* layout = (newVar->TypeOffset != 0) ? SymbolAttachType(scope, typeTarget(node), newVar) : nullptr;
+        if (layout)
         {
-            auto it = node->cu->typeList.find(node->typeOffset);
-            if (it != node->cu->typeList.end())
-            {
-                TreeElementType* typeNode = it->second;
-                symbolSize += SymbolResolveType(typeNode, newVar);
-                newVar->Size.push_back(symbolSize);
-                parent->Size.push_back(symbolSize);
+            symbolSize += layout->SymbolSize;
+            newVar->Size.push_back(symbolSize);
+            parent->Size.push_back(symbolSize);
 
-                /* Propagate type */
-                parent->DataType = newVar->DataType;
-            }
+            /* Propagate type */
+            parent->DataType = newVar->DataType;
         }
     }
-    else if (FILEBIN_DWARF_ELEMENT_ARRAY_DIM == node->elementType)
+    else if (FILEBIN_DWARF_ELEMENT_ARRAY_DIM == node.Tag())
     {
-        newVar = new FileBin_DWARF_VarInfoType();
-        newVar->data = {'D', 'I', 'M', 'A', 'Y'};
-        newVar->TypeOffset = node->typeOffset;
+        newVar = NewVarInfo(scope.Arena);
+        newVar->elementType = node.Tag();
+        newVar->nameId = this->DimLabelId;
+        newVar->TypeOffset = node.TypeOffset();
         newVar->isQualifier = true;
-        newVar->Addr = parent->Addr;
 
         std::cout << "DIMARRAY" << std::endl;
 
@@ -1544,83 +1857,153 @@ uint8_t FileBin_DWARF::SymbolResolveType(TreeElementType* node, FileBin_DWARF_Va
         }
 
 
-        // Lookup type in CU typeList
-        if ((node->cu)&&(newVar->TypeOffset != 0))
+        // Attach the shared layout of the dimension type
+        const FileBin_DWARF_TypeLayoutType* layout = (newVar->TypeOffset != 0) ? SymbolAttachType(scope, typeTarget(node), newVar) : nullptr;
+        if (layout)
+        {
+            symbolSize += layout->SymbolSize;
+            newVar->Size.push_back(symbolSize);
+        }
+    }
+    return symbolSize;
+}
+
+const FileBin_DWARF_TypeLayoutType* FileBin_DWARF::SymbolAttachType(FileBin_DWARF_SymbolScopeType& scope, uint64_t typeOffset, FileBin_DWARF_VarInfoType* parent)
+{
+    FileBin_DWARF_CompileUnitType* cu = scope.Unit;
+    FileBin_DWARF_TypeLayoutType* layout = nullptr;
+
+    auto cached = scope.TypeLayout->find(typeOffset);
+    if (cached != scope.TypeLayout->end())
+    {
+        layout = cached->second;
+    }
+    else
+    {
+        // Types of the unit itself by unit relative offset, the others through the DIE index
+        FileBin_DWARF_DieCursor typeNode;
+        if (typeOffset - cu->Offset < cu->Size())
         {
-            auto it = node->cu->typeList.find(node->typeOffset);
-            if (it != node->cu->typeList.end())
+            auto it = cu->typeList.find(static_cast<uint32_t>(typeOffset - cu->Offset));
+            if (it != cu->typeList.end())
             {
-                TreeElementType* typeNode = it->second;
-                // Recursively traverse the type tree and attach as child
-                symbolSize += SymbolResolveType(typeNode, newVar);
-                newVar->Size.push_back(symbolSize);
+                typeNode = FileBin_DWARF_DieCursor(cu, it->second);
             }
         }
+        else
+        {
+            typeNode = FindDIE(typeOffset);
+        }
+
+        if (!typeNode.Valid())
+        {
+            return nullptr;
+        }
+
+        // Resolve once against a blank user, what it receives is what every user receives
+        FileBin_DWARF_VarInfoType scratch;
+        uint32_t symbolSize = SymbolResolveType(scope, typeNode, &scratch);
+
+        layout = scope.Arena->New<FileBin_DWARF_TypeLayoutType>(scope.Arena);
+        layout->Node = scratch.child;
+        layout->DataType = scratch.DataType;
+        layout->Size.assign(scratch.Size.begin(), scratch.Size.end());
+        layout->SymbolSize = symbolSize;
+        layout->SizeAppend = (typeNode.Tag() == FILEBIN_DWARF_ELEMENT_ENUMERATION) ||
+                             (typeNode.Tag() == FILEBIN_DWARF_ELEMENT_ARRAY);
+
+        scope.TypeLayout->emplace(typeOffset, layout);
     }
-    return symbolSize;
+
+    // Layout nodes are shared, they are linked but never modified
+    parent->child = layout->Node;
+    parent->DataType = layout->DataType;
+    if (layout->SizeAppend)
+    {
+        parent->Size.insert(parent->Size.end(), layout->Size.begin(), layout->Size.end());
+    }
+    else if (!layout->Size.empty())
+    {
+        parent->Size.assign(layout->Size.begin(), layout->Size.end());
+    }
+
+    return layout;
 }
 
-void FileBin_DWARF::SymbolTraverse(TreeElementType* node, FileBin_DWARF_VarInfoType* parent)
+void FileBin_DWARF::SymbolTraverse(FileBin_DWARF_SymbolScopeType& scope, FileBin_DWARF_DieCursor node, FileBin_DWARF_DieCursor end, FileBin_DWARF_VarInfoType* parent)
 {
+    // Variables are appended after the current last child
+    FileBin_DWARF_VarInfoType* last = parent->child;
+    while (last && last->next) last = last->next;
 
-    while (node != nullptr)
+    while (node.Valid() && (node.Row != end.Row))
     {
 
         FileBin_DWARF_VarInfoType* newVar = nullptr;
 
         // Only create a FileBin_VarInfoType node for actual variables that are also not just a declaration
-        if ((node->elementType == FILEBIN_DWARF_ELEMENT_VARIABLE) && (!node->isDeclaration))
+        if ((node.Tag() == FILEBIN_DWARF_ELEMENT_VARIABLE) && (!node.IsDeclaration()))
         {
 
-            //std::cout << "Address: " << std::hex << node->Addr << std::endl;
+            //std::cout << "Address: " << std::hex << node.Addr() << std::endl;
+
+            // Definition of a variable declared in another unit (LTO), name and type are taken from there
+            FileBin_DWARF_DieCursor origin = node.IsOriginRef() ? FindDIE(node.Unit->originRefs.at(node.Row)) : FileBin_DWARF_DieCursor();
+            FileBin_DWARF_DieCursor decl = (origin.Valid() && (node.TypeOffset() == 0)) ? origin : node;
+
+            newVar = NewVarInfo(scope.Arena);
+            newVar->nameId = (origin.Valid() && (node.NameId() == 0)) ? origin.NameId() : node.NameId();
+            newVar->elementType = FILEBIN_DWARF_ELEMENT_VARIABLE;
+            newVar->Addr = node.Addr();
+            newVar->TypeOffset = decl.TypeOffset();
 
-            newVar = new FileBin_DWARF_VarInfoType();
-            newVar->data = node->data;
-            newVar->Addr = node->Addr;
-            newVar->TypeOffset = node->typeOffset;
+            // First definition wins, later ones stay reachable through the unit list
+            if (newVar->nameId != 0)
+            {
+                scope.SymbolIndex->emplace(newVar->nameId, newVar);
+            }
 
             // Append to parent's child list
-            if (!parent->child)
+            if (!last)
             {
                 parent->child = newVar;
             }
             else
             {
-                FileBin_DWARF_VarInfoType* last = parent->child;
-                while (last->next) last = last->next;
                 last->next = newVar;
             }
+            last = newVar;
 
             // Lookup type in CU typeList
-            if (node->cu)
+            if (newVar->TypeOffset != 0)
             {
-                if (newVar->TypeOffset != 0)
-                {
-                    auto it = node->cu->typeList.find(node->typeOffset);
-                    if (it != node->cu->typeList.end())
-                    {
-                        TreeElementType* typeNode = it->second;
-                        // Recursively traverse the type tree and attach as child
-                        SymbolResolveType(typeNode, newVar);
-                    }
-                }
-                else
-                {
-                    std::cout << "Unable to resolve type: " << std::hex << node->Addr << std::endl;
-                }
+                // Attach the layout shared by every variable of this type
+                SymbolAttachType(scope, typeTarget(decl), newVar);
+            }
+            else
+            {
+                std::cout << "Unable to resolve type: " << std::hex << node.Addr() << std::endl;
             }
         }
         // Move to next sibling
-        node = node->next;
+        node = node.Next();
     }
 }
 
-void FileBin_DWARF::ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint32_t AbbrevOffset, uint32_t InfoOffset, uint32_t InfoLen)
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint64_t AbbrevOffset, uint64_t InfoOffset, uint64_t InfoLen, bool TypeSection,
+                                               const FileBin_DWARF_SplitSectionsType* Split)
 {
+    /* .debug_types and split file units are numbered after the units read so far, so unit offsets stay unique and ordered */
+    uint64_t unitBase = 0;
+    if ((TypeSection || Split) && !this->CompilationUnit.empty())
+    {
+        unitBase = std::max(this->InfoLen, this->CompilationUnit.back()->Offset + this->CompilationUnit.back()->Size());
+    }
     const uint8_t* start = fileData + InfoOffset;
     const uint8_t* end   = start + InfoLen;
 
-    uint32_t offset = 0;
+    uint64_t offset = 0;
 
     while (offset < InfoLen)
     {
@@ -1632,41 +2015,101 @@ void FileBin_DWARF::ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint32_t
         // Allocate new CU
         FileBin_DWARF_CompileUnitType* newCU = new FileBin_DWARF_CompileUnitType();
 
-        // unit_length (does not include itself)
-        uint32_t unitLength = readU32(ptr);
+        // unit_length (does not include itself), the escape value switches the unit to 64-bit DWARF
+        uint64_t unitLength = readU32<Order>(ptr);
         if (unitLength == 0)
         {
             delete newCU;
             break;
         }
 
+        if (unitLength == FILEBIN_DWARF64_UNIT_LENGTH)
+        {
+            if (ptr + 8 > end)
+            {
+                delete newCU;
+                throw std::runtime_error("Truncated CU");
+            }
+
+            unitLength = readU64<Order>(ptr);
+            newCU->OffsetSize = 8;
+        }
+        else if (unitLength >= 0xfffffff0u)
+        {
+            delete newCU;
+            throw std::runtime_error("Reserved unit length");
+        }
+
         newCU->Length_Bytes = unitLength;
-        newCU->Offset       = offset;
+        newCU->Offset       = unitBase + offset;
+        newCU->Data         = fileData;
+        newCU->FileOffset   = InfoOffset + offset;
+        newCU->Split        = Split;
 
-        if (ptr + unitLength > end)
+        if (unitLength > static_cast<uint64_t>(end - ptr))
         {
             delete newCU;
             throw std::runtime_error("Truncated CU");
         }
 
+        // DIE offsets and rows are unit relative on 32 bits, a larger 64-bit DWARF unit is left out
+        if (newCU->Size() > UINT32_MAX)
+        {
+            std::cerr << "[WARNING] Unit at 0x" << std::hex << newCU->Offset << std::dec << " larger than 4 GiB, skipped\n";
+            offset += newCU->Size();
+            delete newCU;
+            continue;
+        }
+
+        // unit_length field, then the header fields below
+        uint8_t headerSize = (newCU->OffsetSize == 8) ? 12 : 4;
+
         // DWARF version
-        newCU->Version = readU16(ptr);
+        newCU->Version = readU16<Order>(ptr);
 
         if (newCU->Version <= 4)
         {
             // DWARF 2–4
-            newCU->AbrevOffset = readU32(ptr);
+            newCU->AbrevOffset = readOffset<Order>(ptr, newCU->OffsetSize);
             newCU->AddrSize    = *ptr++;
             newCU->UnitType    = DW_UT_compile;
-            HeaderSize_Byte    = 11;
+            newCU->HeaderSize_Byte = headerSize + 3 + newCU->OffsetSize;
+
+            if (TypeSection)
+            {
+                newCU->UnitType = DW_UT_type;
+                newCU->TypeSignature = readU64<Order>(ptr);
+                newCU->TypeDieOffset = readOffset<Order>(ptr, newCU->OffsetSize);
+                newCU->HeaderSize_Byte += 8 + newCU->OffsetSize;
+            }
         }
         else if (newCU->Version == 5)
         {
             // DWARF 5
             newCU->UnitType    = *ptr++;
             newCU->AddrSize    = *ptr++;
-            newCU->AbrevOffset = readU32(ptr);
-            HeaderSize_Byte    = 12;
+            newCU->AbrevOffset = readOffset<Order>(ptr, newCU->OffsetSize);
+            newCU->HeaderSize_Byte = headerSize + 4 + newCU->OffsetSize;
+
+            // Unit type specific fields precede the first DIE
+            switch (newCU->UnitType)
+            {
+                case DW_UT_skeleton:
+                case DW_UT_split_compile:
+                    newCU->DwoId = readU64<Order>(ptr);
+                    newCU->HeaderSize_Byte += 8;
+                    break;
+
+                case DW_UT_type:
+                case DW_UT_split_type:
+                    newCU->TypeSignature = readU64<Order>(ptr);
+                    newCU->TypeDieOffset = readOffset<Order>(ptr, newCU->OffsetSize);
+                    newCU->HeaderSize_Byte += 8 + newCU->OffsetSize;
+                    break;
+
+                default:
+                    break;
+            }
         }
         else
         {
@@ -1683,147 +2126,1170 @@ void FileBin_DWARF::ParseAllAbbrvSectionHeader(const uint8_t* fileData, uint32_t
                   << " (absolute 0x" << (AbbrevOffset + newCU->AbrevOffset) << ")"
                   << std::dec << std::endl;
 #endif
+        // Advance offset (unit_length + sizeof(unit_length))
+        offset += newCU->Size();
+
+        // Type units are also found by signature. Each .dwo file carries the type units it uses, the first copy serves all
+        if ((newCU->UnitType == DW_UT_type) || (newCU->UnitType == DW_UT_split_type))
+        {
+            if (!this->TypeUnits.emplace(newCU->TypeSignature, newCU).second)
+            {
+                delete newCU;
+                continue;
+            }
+            newCU->TypeUnit = true;
+        }
+
         // Append CU
         this->CompilationUnit.push_back(newCU);
-
-        // Advance offset (unit_length + sizeof(unit_length))
-        offset += newCU->Length_Bytes + 4;
     }
 }
 
-void FileBin_DWARF::FreeTree(TreeElementType* node)
+uint64_t FileBin_DWARF::UnitFingerprint(const FileBin_DWARF_CompileUnitType* cu)
 {
-    if (!node) return;
-    FreeTree(node->child);
-    FreeTree(node->next);
-    delete node;
-}
+    /* Rows in document order, whatever order they were decoded in, each child list closed by a marker.
+     * Type references are unit relative, so equal prints resolve to equal symbol trees */
+    const FileBin_DIEStore& dies = cu->Dies;
+    std::vector<uint32_t> flat;
+    flat.reserve(dies.Rows() * 6u);
 
-void FileBin_DWARF::FreeSymTree(FileBin_DWARF_VarInfoType* node)
-{
-    if (!node) return;
-    FreeSymTree(node->child);
-    FreeSymTree(node->next);
-    delete node;
+    std::vector<uint32_t> stack;
+    stack.push_back(dies.FirstChild[0]);
+
+    while (!stack.empty())
+    {
+        uint32_t row = stack.back();
+
+        if (row == FILEBIN_DIESTORE_NONE)
+        {
+            stack.pop_back();
+            flat.push_back(FILEBIN_DIESTORE_NONE);
+
+            if (!stack.empty())
+            {
+                stack.back() = dies.Sibling[stack.back()];
+            }
+            continue;
+        }
+
+        flat.push_back(dies.Tag[row] | (dies.Flags[row] << 8) | (dies.Encoding[row] << 16) | (static_cast<uint32_t>(dies.DimCount[row]) << 24));
+        flat.push_back(dies.NameId[row]);
+        flat.push_back(dies.TypeOffset[row]);
+        flat.push_back(dies.Location[row]);
+        flat.push_back(static_cast<uint32_t>(dies.Addr[row]));
+        flat.push_back(static_cast<uint32_t>(dies.Addr[row] >> 32));
+        for (uint32_t idx = 0; idx < dies.DimCount[row]; idx++)
+        {
+            flat.push_back(dies.GetDim(row, idx));
+        }
+
+        stack.push_back(dies.FirstChild[row]);
+    }
+
+    return FileBin_Hash64(reinterpret_cast<const uint8_t*>(flat.data()), flat.size() * sizeof(uint32_t));
 }
 
-uint8_t FileBin_DWARF::Parse(std::string file_name, uint32_t Offset, uint32_t Len, uint32_t InfoOffset, uint32_t InfoLen, uint32_t StrOffset)
+void FileBin_DWARF::DropReloadUnits(void)
 {
-    // Open memory-mapped file
-    MappedFile file;
-    if (!file.open(file_name))
+    for (auto& prev : this->ReloadUnits)
     {
-        std::cout << "Failed to open file: " << file_name << "\n";
-        return 1;
+        delete prev.second;
     }
+    this->ReloadUnits.clear();
+}
 
-    // Store offsets
-    this->StrOffset = StrOffset;
-    this->InfoOffset = InfoOffset;
-    this->fileBase = file.data;
+FileBin_DWARF_VarInfoType* FileBin_DWARF::NewVarInfo(FileBin_DWARF_CompileUnitType* cu)
+{
+    return NewVarInfo(&cu->Arena);
+}
+
+FileBin_DWARF_VarInfoType* FileBin_DWARF::NewVarInfo(FileBin_Arena* arena)
+{
+    return arena->New<FileBin_DWARF_VarInfoType>(arena);
+}
 
-    FreeTree(this->DataRoot);
-    this->DataRoot = nullptr;
+/* Work estimate of a unit for the thread pool, its size clamped to the weight range */
+static inline uint32_t unitWeight(const FileBin_DWARF_CompileUnitType* cu)
+{
+    return static_cast<uint32_t>(std::min<uint64_t>(cu->Length_Bytes, UINT32_MAX));
+}
 
-    for (auto* cu : this->CompilationUnit)
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ParseUnits(const uint8_t* fileData, uint64_t AbbrevOffset, uint64_t InfoOffset, uint64_t InfoLen)
+{
+    /* Identify and parse all compilation units headers (does not go deeper into parsing)
+     * A bad unit header ends its section, the units read before it are kept */
+    try
     {
-        delete cu;
+        this->ParseAllAbbrvSectionHeader<Order>(fileData, AbbrevOffset, InfoOffset, InfoLen);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ERROR] .debug_info: " << e.what() << ", " << CompilationUnit.size() << " units kept\n";
     }
-    this->CompilationUnit.clear();
-
-    this->AbbrevOffsetCache.clear();
-
-    FreeSymTree(this->SymbolRoot);
-    this->SymbolRoot = nullptr;
 
-    /* Identify and parse all compilation units headers (does not go deeper into parsing) */
-    this->ParseAllAbbrvSectionHeader(file.data, Offset, InfoOffset, InfoLen);
+    if (this->Sections.TypesLen > 0)
+    {
+        const size_t infoUnitCnt = CompilationUnit.size();
+        try
+        {
+            this->ParseAllAbbrvSectionHeader<Order>(fileData, AbbrevOffset, this->Sections.TypesOffset, this->Sections.TypesLen, true);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[ERROR] .debug_types: " << e.what() << ", " << (CompilationUnit.size() - infoUnitCnt) << " units kept\n";
+        }
+    }
     uint32_t cuCnt = static_cast<uint32_t>(CompilationUnit.size());
     if (cuCnt == 0)
     {
-        std::cout << "Failefile: " << file_name << "\n";
-        return 0;
+        return;
     }
     //this->PrintAllAbbrevInfo();
 
-    std::vector<TreeElementType*> cuTreeNodes(cuCnt); // Direct mapping
-    TreeElementType* currItem = new TreeElementType();
-    this->DataRoot = currItem;
-
-    // Build TreeElementType for each compilation unit
+    // Tree roots first, the units themselves are independent
     for (uint32_t t = 0; t < cuCnt; t++)
     {
-        cuTreeNodes[t] = currItem; // Map index 't' to the tree node
-
-        const uint8_t* abbrevPtr = file.data + Offset + CompilationUnit[t]->AbrevOffset;
-        CompilationUnit[t]->AbbrevInfo = ParseAbbrevOffset(abbrevPtr);
-        const uint8_t* cuStart = file.data + InfoOffset + CompilationUnit[t]->Offset + HeaderSize_Byte;
-        //const uint8_t* ptr = cuStart;
-        ParseDIE(cuStart, file.data, InfoOffset + CompilationUnit[t]->Offset, CompilationUnit[t]->Length_Bytes, CompilationUnit[t], currItem);
-
-        if (t < cuCnt - 1)
-        {
-            currItem->next = new TreeElementType();
-            currItem = currItem->next;
-        }
+        CompilationUnit[t]->Dies.Append(static_cast<uint8_t>(FILEBIN_DWARF_ELEMENT__UNKNOWN), FILEBIN_DIESTORE_NONE);
     }
 
-    // -----------------------------
-    // Multithreaded SymbolTraverse
-    // -----------------------------
-    std::mutex symbolMutex;
-    FileBin_DWARF_VarInfoType* lastSymbol = nullptr;
-    std::vector<FileBin_DWARF_VarInfoType*> cuSymbols(cuCnt, nullptr);
-    std::vector<std::thread> threads2;
+    // Build the DIE store of each compilation unit, weighted by unit size
+    std::vector<uint32_t> weights(cuCnt);
+    for (uint32_t t = 0; t < cuCnt; t++)
+    {
+        weights[t] = unitWeight(CompilationUnit[t]);
+    }
 
-    // Determine maximum concurrent threads
-    const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    const bool reload = !this->ReloadUnits.empty();
 
-    std::mutex queueMutex;
-    std::queue<uint32_t> tasks;
-    for (uint32_t t = 0; t < cuCnt; ++t)
-        tasks.push(t);
+    auto parseUnit = [&](uint32_t t) {
+        FileBin_DWARF_CompileUnitType* cu = CompilationUnit[t];
 
-    auto worker = [&]() {
-        while (true) {
-            uint32_t t;
+        try
+        {
+            // Split units come with their own abbreviations
+            const uint8_t* abbrevPtr = cu->Split ? (cu->Split->Data + cu->Split->AbbrevOffset + cu->AbrevOffset)
+                                                 : (fileData + AbbrevOffset + cu->AbrevOffset);
+            cu->AbbrevInfo = ParseAbbrevOffset(abbrevPtr, cu->OffsetSize);
+            const uint8_t* cuStart = cu->Data + cu->FileOffset + cu->HeaderSize_Byte;
+            ReadUnitBases<Order>(cu, cuStart);
+            if (!this->Lazy)
             {
-                std::lock_guard<std::mutex> lock(queueMutex);
-                if (tasks.empty()) return;
-                t = tasks.front();
-                tasks.pop();
+                cu->Dies.Reserve(cu->Length_Bytes / FILEBIN_DWARF_DIE_BYTES_ESTIMATE);
             }
+            ParseDIE<Order>(cuStart, cu->Data, cu->FileOffset, cu->Size(), cu, 0, this->Lazy);
 
-            // FIX: Direct O(1) access. No more for loop here.
-            TreeElementType* targetNode = cuTreeNodes[t];
-
-            FileBin_DWARF_VarInfoType* cuSymbol = new FileBin_DWARF_VarInfoType();
-
-            // Navigation depends on how ParseDIE attaches data:
-            // Usually, the first child is the DW_TAG_compile_unit
-            if (targetNode->child) {
-                cuSymbol->data = targetNode->child->data;
-                cuSymbol->elementType = FILEBIN_DWARF_ELEMENT_COMPILE_UNIT;
-
-                // Recurse into children of the CU (functions, types, globals)
-                if (targetNode->child->child)
-                {
-                    SymbolTraverse(targetNode->child->child, cuSymbol);
-                }
+            if (reload)
+            {
+                ReuseUnit<Order>(t);
             }
-
-            cuSymbols[t] = cuSymbol;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[ERROR] CU at 0x" << std::hex << cu->Offset << std::dec << ": " << e.what() << "\n";
         }
     };
 
-    // Launch threads (limited to maxThreads)
-    std::vector<std::thread> threads;
-    for (unsigned int i = 0; i < std::min(maxThreads, cuCnt); ++i)
-        threads.emplace_back(worker);
+    ParallelFor("DIE parse", weights, parseUnit);
 
-    // Wait for threads to finish
-    for (auto& th : threads)
-        th.join();
+    // Skeleton units (-gsplit-dwarf) only point at their split unit, parsed the same way from its own file
+    if (std::any_of(CompilationUnit.begin(), CompilationUnit.end(), [](const FileBin_DWARF_CompileUnitType* cu) { return cu->Skeleton; }))
+    {
+        ParseSplitUnits<Order>(parseUnit);
+        cuCnt = static_cast<uint32_t>(CompilationUnit.size());
+        weights.resize(cuCnt);
+    }
+
+    // Tree roots are linked serially, after a reload may have swapped units
+    for (uint32_t t = 1; t < cuCnt; t++)
+    {
+        CompilationUnit[t - 1]->NextUnit = CompilationUnit[t];
+    }
+    this->DataRoot = FileBin_DWARF_DieCursor(CompilationUnit[0], 0);
+
+    // References into other units go through the DIE index, built only when some unit has one. Lazy parses
+    // index a unit when it is first referenced, see FindDIE()
+    if (!this->Lazy && std::any_of(CompilationUnit.begin(), CompilationUnit.end(), [](const FileBin_DWARF_CompileUnitType* cu) {
+            return !cu->typeRefs.empty() || !cu->originRefs.empty();
+        }))
+    {
+        for (uint32_t t = 0; t < cuCnt; t++)
+        {
+            weights[t] = static_cast<uint32_t>(CompilationUnit[t]->typeList.size() + CompilationUnit[t]->varList.size()) + 1;
+        }
+
+        ParallelFor("DIE index", weights, [&](uint32_t t) {
+            IndexUnit(t);
+        });
+    }
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ParseSplitUnits(const std::function<void(uint32_t)>& parseUnit)
+{
+    std::vector<FileBin_DWARF_SplitSourceType> sources;
+    this->OpenSplitUnits(sources);
+
+    // Headers serially as for the parsed file, offsets and type signatures are assigned in order
+    const uint32_t first = static_cast<uint32_t>(CompilationUnit.size());
+    std::vector<std::pair<FileBin_DWARF_CompileUnitType*, uint32_t>> splitUnits; /* Skeleton, index of its split unit */
+
+    for (const FileBin_DWARF_SplitSourceType& source : sources)
+    {
+        uint32_t unitIdx = static_cast<uint32_t>(CompilationUnit.size());
+
+        try
+        {
+            ParseAllAbbrvSectionHeader<Order>(source.Sections->Data, source.Sections->AbbrevOffset, source.InfoOffset, source.InfoLen,
+                                              source.TypeSection, source.Sections);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[ERROR] Split unit of " << (source.Skeleton ? source.Skeleton->DwoName : std::string("package")) << ": " << e.what() << "\n";
+        }
+
+        for (; source.Skeleton && (unitIdx < CompilationUnit.size()); unitIdx++)
+        {
+            if (!CompilationUnit[unitIdx]->TypeUnit)
+            {
+                CompilationUnit[unitIdx]->AddrBase = source.Skeleton->AddrBase;
+                splitUnits.emplace_back(source.Skeleton, unitIdx);
+                break;
+            }
+        }
+    }
+
+    const uint32_t splitCnt = static_cast<uint32_t>(CompilationUnit.size()) - first;
+    std::vector<uint32_t> weights(splitCnt);
+    for (uint32_t t = 0; t < splitCnt; t++)
+    {
+        CompilationUnit[first + t]->Dies.Append(static_cast<uint8_t>(FILEBIN_DWARF_ELEMENT__UNKNOWN), FILEBIN_DIESTORE_NONE);
+        weights[t] = unitWeight(CompilationUnit[first + t]);
+    }
+
+    ParallelFor("Split DIE parse", weights, [&](uint32_t t) {
+        parseUnit(first + t);
+    });
+
+    // A split unit takes the place of its skeleton, unless it comes from a stale .dwo file of another build
+    std::unordered_set<const FileBin_DWARF_CompileUnitType*> dropped;
+    for (const auto& entry : splitUnits)
+    {
+        FileBin_DWARF_CompileUnitType* skeleton = entry.first;
+        FileBin_DWARF_CompileUnitType* split = CompilationUnit[entry.second];
+
+        if (split->DwoId != skeleton->DwoId)
+        {
+            std::cout << "[WARNING] Split unit id mismatch, ignored: " << skeleton->DwoName << "\n";
+            dropped.insert(split);
+        }
+        else
+        {
+            dropped.insert(skeleton);
+        }
+    }
+
+    CompilationUnit.erase(std::remove_if(CompilationUnit.begin(), CompilationUnit.end(), [&](FileBin_DWARF_CompileUnitType* cu) {
+                              if (dropped.count(cu) == 0)
+                              {
+                                  return false;
+                              }
+                              delete cu;
+                              return true;
+                          }),
+                          CompilationUnit.end());
+
+    this->SplitMissing = static_cast<uint32_t>(std::count_if(CompilationUnit.begin(), CompilationUnit.end(),
+                                                             [](const FileBin_DWARF_CompileUnitType* cu) { return cu->Skeleton; }));
+}
+
+/* Rows of two stores holding the same tree (equal fingerprints), rowMap[row of from] = row of to */
+static void pairRows(const FileBin_DIEStore& from, const FileBin_DIEStore& to, std::vector<uint32_t>& rowMap)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    stack.emplace_back(from.FirstChild[0], to.FirstChild[0]);
+    rowMap[0] = 0;
+
+    while (!stack.empty())
+    {
+        uint32_t fromRow = stack.back().first;
+        uint32_t toRow = stack.back().second;
+        stack.pop_back();
+
+        for (; (fromRow != FILEBIN_DIESTORE_NONE) && (toRow != FILEBIN_DIESTORE_NONE); fromRow = from.Sibling[fromRow], toRow = to.Sibling[toRow])
+        {
+            rowMap[fromRow] = toRow;
+            stack.emplace_back(from.FirstChild[fromRow], to.FirstChild[toRow]);
+        }
+    }
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ReuseUnit(uint32_t idx)
+{
+    FileBin_DWARF_CompileUnitType* cu = CompilationUnit[idx];
+    FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(cu, 0).Child();
+    if (!unitDIE.Valid() || cu->TypeUnit || cu->Skeleton)
+    {
+        return;
+    }
+
+    // The previous unit of the same name is claimed whether it matches or not
+    FileBin_DWARF_CompileUnitType* prev = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(ReloadUnitsMutex);
+        auto it = this->ReloadUnits.find(unitDIE.NameId());
+        if (it == this->ReloadUnits.end())
+        {
+            return;
+        }
+
+        prev = it->second;
+        this->ReloadUnits.erase(it);
+    }
+
+    // The previous unit had every DIE decoded, a lazy one is decoded in full to compare
+    if (this->Lazy)
+    {
+        MaterializeTree<Order>(unitDIE);
+    }
+
+    // Symbols resolved through other units may change with them, such units are always resolved again
+    if (!cu->typeRefs.empty() || !cu->originRefs.empty() || (UnitFingerprint(cu) != UnitFingerprint(prev)))
+    {
+        delete prev;
+        return;
+    }
+
+    // Other units may still reference its types and variables, by their offsets in the new file
+    std::vector<uint32_t> rowMap(cu->Dies.Rows(), FILEBIN_DIESTORE_NONE);
+    pairRows(cu->Dies, prev->Dies, rowMap);
+
+    prev->typeList.clear();
+    for (const auto& entry : cu->typeList)
+    {
+        prev->typeList.emplace(entry.first, rowMap[entry.second]);
+    }
+
+    prev->varList.clear();
+    for (const auto& entry : cu->varList)
+    {
+        prev->varList.emplace(entry.first, rowMap[entry.second]);
+    }
+
+    // Same DIEs at other offsets of the new file
+    prev->Length_Bytes = cu->Length_Bytes;
+    prev->Version = cu->Version;
+    prev->AbrevOffset = cu->AbrevOffset;
+    prev->Offset = cu->Offset;
+    prev->Data = cu->Data;
+    prev->FileOffset = cu->FileOffset;
+    prev->Split = cu->Split;
+    prev->DwoId = cu->DwoId;
+    prev->OffsetSize = cu->OffsetSize;
+    prev->AddrSize = cu->AddrSize;
+    prev->HeaderSize_Byte = cu->HeaderSize_Byte;
+    prev->UnitType = cu->UnitType;
+    prev->StrOffsetsBase = cu->StrOffsetsBase;
+    prev->AddrBase = cu->AddrBase;
+    prev->AbbrevInfo = nullptr; /* Every DIE is decoded already */
+    prev->NextUnit = nullptr;
+    prev->Reused = true;
+    prev->Indexed = false;
+    prev->typeLayout.clear(); /* Keyed by offsets of the old file, its symbols are resolved already */
+    if (prev->Symbols)
+    {
+        prev->Symbols->next = nullptr;
+    }
+
+    delete cu;
+    CompilationUnit[idx] = prev;
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ReadUnitBases(FileBin_DWARF_CompileUnitType* cu, const uint8_t* ptr)
+{
+    // Without the attributes (split units) the tables start after the header of the section: unit_length,
+    // version and padding, 8 bytes in 32-bit DWARF and 16 in 64-bit DWARF. Split units use the addresses of
+    // their skeleton, its base is set already
+    if (cu->Version >= 5)
+    {
+        cu->StrOffsetsBase = 2u * cu->OffsetSize;
+        if (!cu->Split)
+        {
+            cu->AddrBase = 2u * cu->OffsetSize;
+        }
+    }
+
+    // Bases sit on the unit DIE, possibly after strx names depending on them: read them on their own first
+    const FileBin_DWARF_Abbrev* abbrev = cu->AbbrevInfo->Find(FileBin_DWARF_ReadULEB128(ptr));
+    if (!abbrev)
+    {
+        return;
+    }
+
+    const uint8_t* dwoName = nullptr;
+    const uint8_t* compDir = nullptr;
+    const FileBin_DWARF_AbbrevAttr* dwoNameForm = nullptr;
+    const FileBin_DWARF_AbbrevAttr* compDirForm = nullptr;
+
+    for (const FileBin_DWARF_AbbrevAttr& attrForm : abbrev->attributes)
+    {
+        switch (attrForm.attribute)
+        {
+            case DW_AT_str_offsets_base:
+                cu->StrOffsetsBase = ReadAttributeValue<Order>(ptr, attrForm, cu).Value;
+                break;
+
+            case DW_AT_addr_base:
+            case DW_AT_GNU_addr_base:
+                cu->AddrBase = ReadAttributeValue<Order>(ptr, attrForm, cu).Value;
+                break;
+
+            case DW_AT_GNU_dwo_id:
+                cu->DwoId = ReadAttributeValue<Order>(ptr, attrForm, cu).Value;
+                break;
+
+            case DW_AT_dwo_name:
+            case DW_AT_GNU_dwo_name:
+                dwoName = ptr;
+                dwoNameForm = &attrForm;
+                SkipAttributeValue<Order>(ptr, attrForm, cu);
+                break;
+
+            case DW_AT_comp_dir:
+                compDir = ptr;
+                compDirForm = &attrForm;
+                SkipAttributeValue<Order>(ptr, attrForm, cu);
+                break;
+
+            default:
+                SkipAttributeValue<Order>(ptr, attrForm, cu);
+                break;
+        }
+    }
+
+    // A unit of the parsed file naming a .dwo file only stands for the split unit in there
+    if (!cu->Split && (dwoNameForm || (cu->UnitType == DW_UT_skeleton)))
+    {
+        cu->Skeleton = true;
+        if (dwoNameForm)
+        {
+            cu->DwoName = ReadAttributeValue<Order>(dwoName, *dwoNameForm, cu).String();
+        }
+        if (compDirForm)
+        {
+            cu->CompDir = ReadAttributeValue<Order>(compDir, *compDirForm, cu).String();
+        }
+    }
+}
+
+void FileBin_DWARF::IndexUnit(uint32_t idx)
+{
+    /* Only types and variables are referenced across units */
+    FileBin_DWARF_CompileUnitType* cu = CompilationUnit[idx];
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> rows;
+    offsets.reserve(cu->typeList.size() + cu->varList.size());
+    rows.reserve(cu->typeList.size() + cu->varList.size());
+
+    for (const auto& entry : cu->typeList)
+    {
+        offsets.push_back(cu->Offset + entry.first);
+        rows.push_back(entry.second);
+    }
+
+    for (const auto& entry : cu->varList)
+    {
+        offsets.push_back(cu->Offset + entry.first);
+        rows.push_back(entry.second);
+    }
+
+    this->DieIndex.Insert(idx, offsets.data(), rows.data(), static_cast<uint32_t>(offsets.size()));
+    cu->Indexed = true;
+}
+
+FileBin_DWARF_DieCursor FileBin_DWARF::FindDIE(uint64_t offset)
+{
+    FileBin_DIEIndex::EntryType entry;
+    if (this->DieIndex.Find(offset, entry))
+    {
+        return FileBin_DWARF_DieCursor(CompilationUnit[entry.Unit], entry.Row);
+    }
+
+    // Lazy mode: the unit holding the offset is decoded in full and indexed on its first reference
+    auto it = std::upper_bound(this->CompilationUnit.begin(), this->CompilationUnit.end(), offset,
+                               [](uint64_t off, const FileBin_DWARF_CompileUnitType* cu) { return off < cu->Offset; });
+    if (!this->Lazy || (it == this->CompilationUnit.begin()))
+    {
+        return FileBin_DWARF_DieCursor();
+    }
+
+    uint32_t idx = static_cast<uint32_t>(std::distance(this->CompilationUnit.begin(), it) - 1);
+    FileBin_DWARF_CompileUnitType* cu = CompilationUnit[idx];
+    if (cu->Indexed || (offset - cu->Offset >= cu->Size()))
+    {
+        return FileBin_DWARF_DieCursor();
+    }
+
+    if (this->ByteOrder == FILEBIN_BYTEORDER_BIG)
+    {
+        MaterializeTree<FILEBIN_BYTEORDER_BIG>(FileBin_DWARF_DieCursor(cu, 0).Child());
+    }
+    else
+    {
+        MaterializeTree<FILEBIN_BYTEORDER_LITTLE>(FileBin_DWARF_DieCursor(cu, 0).Child());
+    }
+    IndexUnit(idx);
+
+    return FindDIE(offset);
+}
+
+void FileBin_DWARF::UnitSymbolTraverse(FileBin_DWARF_CompileUnitType* cu)
+{
+    FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(cu, 0).Child();
+
+    // Recurse into children of the CU (functions, types, globals)
+    if (unitDIE.Valid())
+    {
+        FileBin_DWARF_SymbolScopeType scope;
+        scope.Unit = cu;
+        scope.Arena = &cu->Arena;
+        scope.TypeLayout = &cu->typeLayout;
+        scope.SymbolIndex = &cu->symbolIndex;
+
+        SymbolTraverse(scope, unitDIE.Child(), FileBin_DWARF_DieCursor(), cu->Symbols);
+    }
+
+    cu->SymbolsLoaded = true;
+}
+
+uint32_t FileBin_DWARF::SplitSymbolRanges(uint32_t unitIdx, uint64_t rangeWeight, std::deque<FileBin_DWARF_SymbolRangeType>& ranges)
+{
+    FileBin_DWARF_CompileUnitType* cu = CompilationUnit[unitIdx];
+    FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(cu, 0).Child();
+    if (!unitDIE.Valid())
+    {
+        return 0;
+    }
+
+    // Rows are in decode order, a top-level DIE and its subtree take the rows up to its next sibling
+    const uint64_t rows = cu->Dies.Rows();
+    const uint64_t weight = unitWeight(cu);
+    const uint64_t rangeRows = std::max<uint64_t>(1, rows / std::max<uint64_t>(1, weight / std::max<uint64_t>(1, rangeWeight)));
+    const size_t first = ranges.size();
+
+    FileBin_DWARF_DieCursor start = unitDIE.Child();
+    uint64_t rangeRowCnt = 0;
+    for (FileBin_DWARF_DieCursor node = start; node.Valid();)
+    {
+        FileBin_DWARF_DieCursor next = node.Next();
+        uint64_t endRow = next.Valid() ? next.Row : rows;
+        rangeRowCnt += (endRow > node.Row) ? (endRow - node.Row) : 1;
+
+        if ((rangeRowCnt >= rangeRows) || !next.Valid())
+        {
+            ranges.emplace_back();
+            FileBin_DWARF_SymbolRangeType& range = ranges.back();
+            range.UnitIdx = unitIdx;
+            range.First = start;
+            range.End = next;
+            range.Weight = static_cast<uint32_t>(std::max<uint64_t>(1, weight * std::min(rangeRowCnt, rows) / std::max<uint64_t>(1, rows)));
+
+            start = next;
+            rangeRowCnt = 0;
+        }
+        node = next;
+    }
+
+    // A single range is no better than the unit task
+    if (ranges.size() - first < 2)
+    {
+        ranges.resize(first);
+        return 0;
+    }
+
+    for (size_t i = first; i < ranges.size(); i++)
+    {
+        cu->RangeArenas.push_back(std::make_unique<FileBin_Arena>());
+        ranges[i].Arena = cu->RangeArenas.back().get();
+    }
+
+    return static_cast<uint32_t>(ranges.size() - first);
+}
+
+void FileBin_DWARF::MergeSymbolRanges(std::deque<FileBin_DWARF_SymbolRangeType>& ranges)
+{
+    // Ranges of a unit follow each other in document order, so did their variables in a single traversal
+    FileBin_DWARF_CompileUnitType* cu = nullptr;
+    FileBin_DWARF_VarInfoType* last = nullptr;
+
+    for (FileBin_DWARF_SymbolRangeType& range : ranges)
+    {
+        if (cu != CompilationUnit[range.UnitIdx])
+        {
+            cu = CompilationUnit[range.UnitIdx];
+            cu->SymbolsLoaded = true;
+            last = nullptr;
+        }
+
+        if (range.Symbols.child)
+        {
+            if (last)
+            {
+                last->next = range.Symbols.child;
+            }
+            else
+            {
+                cu->Symbols->child = range.Symbols.child;
+            }
+
+            for (last = range.Symbols.child; last->next; last = last->next)
+            {
+            }
+        }
+
+        // First definition wins as in a single traversal, type layouts are kept for later lookups
+        cu->symbolIndex.insert(range.SymbolIndex.begin(), range.SymbolIndex.end());
+        cu->typeLayout.insert(range.TypeLayout.begin(), range.TypeLayout.end());
+    }
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::ExpandDIE(FileBin_DWARF_DieCursor node, bool lazy)
+{
+    FileBin_DWARF_CompileUnitType* cu = node.Unit;
+    const uint8_t* ptr = cu->Dies.TakePending(node.Row);
+
+    ParseDIE<Order>(ptr, cu->Data, cu->FileOffset, cu->Size(), cu, node.Row, lazy);
+}
+
+template <FileBin_ByteOrder Order>
+void FileBin_DWARF::MaterializeTree(FileBin_DWARF_DieCursor node)
+{
+    for (; node.Valid(); node = node.Next())
+    {
+        if (node.Unit->Dies.IsPending(node.Row))
+        {
+            // Whole subtree in one pass, keeps declarations decoded ahead of their definitions
+            ExpandDIE<Order>(node, false);
+        }
+        else
+        {
+            MaterializeTree<Order>(node.Child());
+        }
+    }
+}
+
+void FileBin_DWARF::SetLazy(bool Lazy)
+{
+    this->Lazy = Lazy;
+}
+
+bool FileBin_DWARF::IsLazy(void) const
+{
+    return this->Lazy;
+}
+
+void FileBin_DWARF::SetSections(const FileBin_DWARF_SectionsType& Sections)
+{
+    this->Sections = Sections;
+}
+
+FileBin_DWARF_DieCursor FileBin_DWARF::GetChildren(FileBin_DWARF_DieCursor node)
+{
+    if (!node.Valid())
+    {
+        return FileBin_DWARF_DieCursor();
+    }
+
+    if (node.Unit->Dies.IsPending(node.Row))
+    {
+        if (this->ByteOrder == FILEBIN_BYTEORDER_BIG)
+        {
+            ExpandDIE<FILEBIN_BYTEORDER_BIG>(node, true);
+        }
+        else
+        {
+            ExpandDIE<FILEBIN_BYTEORDER_LITTLE>(node, true);
+        }
+    }
+
+    return node.Child();
+}
+
+FileBin_DWARF_VarInfoType* FileBin_DWARF::GetUnitSymbols(FileBin_DWARF_VarInfoType* unitSymbol)
+{
+    if (!unitSymbol)
+    {
+        return nullptr;
+    }
+
+    for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        if ((cu->Symbols != unitSymbol) || cu->SymbolsLoaded)
+        {
+            continue;
+        }
+
+        /* Types are looked up by offset, so every DIE of the unit has to be decoded first */
+        if (this->ByteOrder == FILEBIN_BYTEORDER_BIG)
+        {
+            MaterializeTree<FILEBIN_BYTEORDER_BIG>(FileBin_DWARF_DieCursor(cu, 0).Child());
+        }
+        else
+        {
+            MaterializeTree<FILEBIN_BYTEORDER_LITTLE>(FileBin_DWARF_DieCursor(cu, 0).Child());
+        }
+
+        UnitSymbolTraverse(cu);
+        SearchIndexUnit(cu);
+        break;
+    }
+
+    return unitSymbol->child;
+}
+
+void FileBin_DWARF::SearchIndexDIE(FileBin_DWARF_DieCursor node)
+{
+    for (; node.Valid(); node = node.Next())
+    {
+        if (node.NameId() != 0)
+        {
+            this->DIESearchRefs.push_back(node);
+            this->DIESearch.Add(this->Names.Get(node.NameId()), &this->DIESearchRefs.back());
+        }
+
+        SearchIndexDIE(node.Child());
+    }
+}
+
+void FileBin_DWARF::SearchIndexUnit(FileBin_DWARF_CompileUnitType* cu)
+{
+    /* The unit DIE itself is indexed with the unit headers */
+    FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(cu, 0).Child();
+    if (unitDIE.Valid())
+    {
+        SearchIndexDIE(unitDIE.Child());
+    }
+
+    for (FileBin_DWARF_VarInfoType* var = cu->Symbols ? cu->Symbols->child : nullptr; var != nullptr; var = var->next)
+    {
+        if (var->nameId != 0)
+        {
+            this->SymbolSearch.Add(this->Names.Get(var->nameId), var);
+        }
+    }
+}
+
+std::vector<FileBin_DWARF_VarInfoType*> FileBin_DWARF::SearchSymbols(std::string_view query, uint32_t maxResults)
+{
+    if (!this->SymbolIndexComplete)
+    {
+        this->BuildSymbolIndex();
+    }
+
+    std::vector<FileBin_DWARF_VarInfoType*> result;
+    for (const void* item : this->SymbolSearch.Find(query, maxResults))
+    {
+        result.push_back(static_cast<FileBin_DWARF_VarInfoType*>(const_cast<void*>(item)));
+    }
+
+    return result;
+}
+
+std::vector<FileBin_DWARF_DieCursor> FileBin_DWARF::SearchDIEs(std::string_view query, uint32_t maxResults)
+{
+    if (!this->SymbolIndexComplete)
+    {
+        this->BuildSymbolIndex();
+    }
+
+    std::vector<FileBin_DWARF_DieCursor> result;
+    for (const void* item : this->DIESearch.Find(query, maxResults))
+    {
+        result.push_back(*static_cast<const FileBin_DWARF_DieCursor*>(item));
+    }
+
+    return result;
+}
+
+void FileBin_DWARF::BuildSymbolIndex(void)
+{
+    for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        if (!cu->SymbolsLoaded)
+        {
+            GetUnitSymbols(cu->Symbols);
+        }
+
+        this->SymbolIndex.insert(cu->symbolIndex.begin(), cu->symbolIndex.end());
+    }
+
+    this->SymbolIndexComplete = true;
+}
+
+FileBin_DWARF_VarInfoType* FileBin_DWARF::FindSymbol(std::string_view name)
+{
+    /* Unit paths may hold a drive colon, the symbol name never does */
+    size_t colon = name.rfind(':');
+
+    if (colon == std::string_view::npos)
+    {
+        if (!this->SymbolIndexComplete)
+        {
+            this->BuildSymbolIndex();
+        }
+
+        auto it = this->SymbolIndex.find(this->Names.Find(name));
+        return (it != this->SymbolIndex.end()) ? it->second : nullptr;
+    }
+
+    auto unit = this->UnitIndex.find(name.substr(0, colon));
+    if (unit == this->UnitIndex.end())
+    {
+        return nullptr;
+    }
+
+    FileBin_DWARF_CompileUnitType* cu = unit->second;
+    if (!cu->SymbolsLoaded)
+    {
+        GetUnitSymbols(cu->Symbols);
+    }
+
+    auto it = cu->symbolIndex.find(this->Names.Find(name.substr(colon + 1)));
+    return (it != cu->symbolIndex.end()) ? it->second : nullptr;
+}
+
+uint8_t FileBin_DWARF::ResolvePath(std::string_view path, FileBin_DWARF_SymbolRefType& ref)
+{
+    size_t rootStart = path.rfind(':');
+    rootStart = (rootStart == std::string_view::npos) ? 0 : rootStart + 1;
+
+    size_t pos = path.find_first_of(".[", rootStart);
+    if (pos == std::string_view::npos)
+    {
+        pos = path.size();
+    }
+
+    FileBin_DWARF_VarInfoType* node = FindSymbol(path.substr(0, pos));
+    if (!node)
+    {
+        std::cerr << "Symbol not found: " << path.substr(0, pos) << "\n";
+        return 1;
+    }
+
+    FileBin_DWARF_VarInfoType* type = node; /* Its child chain describes the type the path is at */
+    uint64_t addr = node->Addr;
+    uint32_t dimIdx = 0; /* Array dimensions of node already indexed */
+
+    while (pos < path.size())
+    {
+        /* Arrays keep their dimensions followed by the element size */
+        uint32_t dimCnt = (node->Size.size() > 1) ? static_cast<uint32_t>(node->Size.size() - 1) : 0;
+
+        if (path[pos] == '.')
+        {
+            size_t nameEnd = path.find_first_of(".[", pos + 1);
+            if (nameEnd == std::string_view::npos)
+            {
+                nameEnd = path.size();
+            }
+            std::string_view name = path.substr(pos + 1, nameEnd - pos - 1);
+
+            // Qualifiers and typedefs sit between the user and the structure
+            FileBin_DWARF_VarInfoType* layout = (dimIdx == dimCnt) ? type->child : nullptr;
+            while (layout && (layout->elementType != FILEBIN_DWARF_ELEMENT_STRUCTURE))
+            {
+                layout = layout->child;
+            }
+
+            // A name never interned is no member of anything
+            uint32_t nameId = this->Names.Find(name);
+            FileBin_DWARF_VarInfoType* member = (layout && (nameId != 0)) ? layout->child : nullptr;
+            while (member && (member->nameId != nameId))
+            {
+                member = member->next;
+            }
+
+            if (!member)
+            {
+                std::cerr << "No member " << name << " in " << path.substr(0, pos) << "\n";
+                return 1;
+            }
+
+            addr += member->Addr;
+            node = member;
+            type = member;
+            dimIdx = 0;
+            pos = nameEnd;
+        }
+        else if (path[pos] == '[')
+        {
+            size_t close = path.find(']', pos);
+            uint32_t index = 0;
+            const char* first = path.data() + pos + 1;
+            const char* last = path.data() + ((close == std::string_view::npos) ? path.size() : close);
+
+            if ((close == std::string_view::npos) || (std::from_chars(first, last, index).ptr != last) || (first == last))
+            {
+                std::cerr << "Invalid index in " << path << "\n";
+                return 1;
+            }
+
+            if ((dimIdx >= dimCnt) || (index >= node->Size.at(dimIdx)))
+            {
+                std::cerr << "Index out of range: " << path.substr(0, close + 1) << "\n";
+                return 1;
+            }
+
+            uint32_t stride = node->Size.back();
+            for (uint32_t k = dimIdx + 1; k < dimCnt; k++)
+            {
+                stride *= node->Size.at(k);
+            }
+
+            addr += static_cast<uint64_t>(index) * stride;
+            dimIdx++;
+
+            // Element reached, its type hangs below the array node
+            if (dimIdx == dimCnt)
+            {
+                type = node->child;
+                while (type && (type->elementType != FILEBIN_DWARF_ELEMENT_ARRAY))
+                {
+                    type = type->child;
+                }
+
+                if (!type)
+                {
+                    return 1;
+                }
+            }
+
+            pos = close + 1;
+        }
+        else
+        {
+            std::cerr << "Invalid path " << path << "\n";
+            return 1;
+        }
+    }
+
+    uint32_t dimCnt = (node->Size.size() > 1) ? static_cast<uint32_t>(node->Size.size() - 1) : 0;
+    uint32_t size = node->Size.empty() ? 0 : node->Size.back();
+    for (uint32_t k = dimIdx; k < dimCnt; k++)
+    {
+        size *= node->Size.at(k);
+    }
+
+    ref.Node = node;
+    ref.Addr = addr;
+    ref.DataType = node->DataType;
+    ref.Size = size;
+
+    return 0;
+}
+
+uint32_t FileBin_DWARF::ParallelFor(const char* phase, const std::vector<uint32_t>& weights, const std::function<void(uint32_t)>& fn)
+{
+    const uint32_t count = static_cast<uint32_t>(weights.size());
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const uint32_t threadCnt = std::min(std::max(1u, std::thread::hardware_concurrency()), count);
+
+    /* Largest tasks first, each handed to the least loaded worker */
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return weights[a] > weights[b]; });
+
+    std::vector<FileBin_DWARF_WorkQueueType> queues(threadCnt);
+    std::vector<uint64_t> load(threadCnt, 0);
+    for (uint32_t idx : order)
+    {
+        uint32_t target = static_cast<uint32_t>(std::min_element(load.begin(), load.end()) - load.begin());
+        queues[target].Tasks.push_back(idx);
+        load[target] += weights[idx];
+    }
+
+    std::vector<uint64_t> busyUs(threadCnt, 0);
+    std::vector<uint32_t> taskCnt(threadCnt, 0);
+
+    /* Owner takes its largest task from the front, idle workers steal the smallest from the back of the others.
+       No task is queued once the workers run, so all queues empty means done */
+    auto worker = [&](uint32_t w) {
+        for (;;)
+        {
+            uint32_t idx = 0;
+            bool found = false;
+
+            for (uint32_t v = 0; (v < threadCnt) && !found; v++)
+            {
+                FileBin_DWARF_WorkQueueType& queue = queues[(w + v) % threadCnt];
+                std::lock_guard<std::mutex> lock(queue.Lock);
+
+                if (!queue.Tasks.empty())
+                {
+                    if (v == 0)
+                    {
+                        idx = queue.Tasks.front();
+                        queue.Tasks.pop_front();
+                    }
+                    else
+                    {
+                        idx = queue.Tasks.back();
+                        queue.Tasks.pop_back();
+                    }
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                break;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            fn(idx);
+            busyUs[w] += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            taskCnt[w]++;
+        }
+    };
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    // Calling thread takes part as well
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCnt; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+
+    worker(0);
+
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    uint64_t wallUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wallStart).count();
+
+    std::cout << "[INFO] " << phase << " worker utilisation:";
+    for (uint32_t i = 0; i < threadCnt; i++)
+    {
+        std::cout << " " << ((wallUs > 0) ? (busyUs[i] * 100u / wallUs) : 100u) << "% (" << taskCnt[i] << ")";
+    }
+    std::cout << "\n";
+
+    return threadCnt;
+}
+
+uint32_t FileBin_DWARF::ParseAndResolve(uint64_t AbbrevOffset, uint64_t InfoLen)
+{
+    /* Identify and parse all compilation units, the target byte order is resolved once here */
+    if (this->ByteOrder == FILEBIN_BYTEORDER_BIG)
+    {
+        this->ParseUnits<FILEBIN_BYTEORDER_BIG>(this->fileBase, AbbrevOffset, this->InfoOffset, InfoLen);
+    }
+    else
+    {
+        this->ParseUnits<FILEBIN_BYTEORDER_LITTLE>(this->fileBase, AbbrevOffset, this->InfoOffset, InfoLen);
+    }
+
+    uint32_t cuCnt = static_cast<uint32_t>(CompilationUnit.size());
+    if (cuCnt == 0)
+    {
+        return 0;
+    }
+
+    // -----------------------------
+    // Multithreaded SymbolTraverse
+    // -----------------------------
+    FileBin_DWARF_VarInfoType* lastSymbol = nullptr;
+    std::vector<FileBin_DWARF_VarInfoType*> cuSymbols(cuCnt, nullptr);
+
+    std::vector<uint32_t> weights(cuCnt);
+    uint64_t totalWeight = 0;
+    for (uint32_t t = 0; t < cuCnt; t++)
+    {
+        weights[t] = (CompilationUnit[t]->Reused || CompilationUnit[t]->TypeUnit) ? 1 : unitWeight(CompilationUnit[t]);
+        totalWeight += weights[t];
+    }
+
+    // A unit heavier than one worker's share would keep its worker busy long after the others are done, its
+    // top-level DIEs are resolved as ranges by tasks of their own (indices past cuCnt), the unit task only sets it up
+    std::deque<FileBin_DWARF_SymbolRangeType> ranges;
+    std::vector<uint8_t> unitSplit(cuCnt, 0);
+    const uint64_t share = totalWeight / std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t t = 0; (t < cuCnt) && !this->Lazy; t++)
+    {
+        if (!CompilationUnit[t]->Reused && !CompilationUnit[t]->TypeUnit && (weights[t] > share) &&
+            (SplitSymbolRanges(t, share / FILEBIN_DWARF_RANGES_PER_WORKER, ranges) > 0))
+        {
+            unitSplit[t] = 1;
+            weights[t] = 1;
+        }
+    }
+    for (const FileBin_DWARF_SymbolRangeType& range : ranges)
+    {
+        weights.push_back(range.Weight);
+    }
+
+    uint32_t threadCnt = ParallelFor(this->Lazy ? "Unit setup" : "Symbol traverse", weights, [&](uint32_t t) {
+        if (t >= cuCnt)
+        {
+            FileBin_DWARF_SymbolRangeType& range = ranges[t - cuCnt];
+
+            FileBin_DWARF_SymbolScopeType scope;
+            scope.Unit = CompilationUnit[range.UnitIdx];
+            scope.Arena = range.Arena;
+            scope.TypeLayout = &range.TypeLayout;
+            scope.SymbolIndex = &range.SymbolIndex;
+
+            SymbolTraverse(scope, range.First, range.End, &range.Symbols);
+            return;
+        }
+
+        if (CompilationUnit[t]->Reused)
+        {
+            cuSymbols[t] = CompilationUnit[t]->Symbols;
+            return;
+        }
+
+        // Type units only serve type lookups, they stay out of the symbol tree
+        if (CompilationUnit[t]->TypeUnit)
+        {
+            CompilationUnit[t]->SymbolsLoaded = true;
+            return;
+        }
+
+        FileBin_DWARF_VarInfoType* cuSymbol = NewVarInfo(CompilationUnit[t]);
+        CompilationUnit[t]->Symbols = cuSymbol;
+
+        // Navigation depends on how ParseDIE attaches data:
+        // Usually, the first child is the DW_TAG_compile_unit
+        FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(CompilationUnit[t], 0).Child();
+        if (unitDIE.Valid()) {
+            cuSymbol->nameId = unitDIE.NameId();
+            cuSymbol->elementType = FILEBIN_DWARF_ELEMENT_COMPILE_UNIT;
+        }
+
+        // In lazy mode the variables are resolved by GetUnitSymbols()
+        if (!this->Lazy && !unitSplit[t])
+        {
+            UnitSymbolTraverse(CompilationUnit[t]);
+        }
+
+        cuSymbols[t] = cuSymbol;
+    });
+
+    MergeSymbolRanges(ranges);
 
     // Append to global Symbol list sequentially
     lastSymbol = nullptr;
@@ -1838,8 +3304,161 @@ uint8_t FileBin_DWARF::Parse(std::string file_name, uint32_t Offset, uint32_t Le
         lastSymbol = cuSymbols[t];
     }
 
-    std::cout << "[INFO] Parsed symbols from " << cuCnt
-              << " compilation units using " << threads.size() << " threads\n";
+    return threadCnt;
+}
+
+uint8_t FileBin_DWARF::Parse(std::string file_name, uint64_t Offset, uint64_t Len, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset, FileBin_ByteOrder ByteOrder)
+{
+    (void)Len;
+    return this->ParseFile(file_name, Offset, InfoOffset, InfoLen, StrOffset, ByteOrder, false);
+}
+
+uint8_t FileBin_DWARF::Reload(std::string file_name, uint64_t Offset, uint64_t Len, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset, FileBin_ByteOrder ByteOrder)
+{
+    (void)Len;
+    return this->ParseFile(file_name, Offset, InfoOffset, InfoLen, StrOffset, ByteOrder, true);
+}
+
+uint8_t FileBin_DWARF::ParseFile(std::string file_name, uint64_t Offset, uint64_t InfoOffset, uint64_t InfoLen, uint64_t StrOffset,
+                                 FileBin_ByteOrder ByteOrder, bool reload)
+{
+    if (reload && !this->CompilationUnit.empty())
+    {
+        // Resolved units stay alive as candidates, their names and DIE columns must outlive the old mapping
+        this->Names.Own();
+
+        for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+        {
+            FileBin_DWARF_DieCursor unitDIE = FileBin_DWARF_DieCursor(cu, 0).Child();
+
+            if (cu->SymbolsLoaded && unitDIE.Valid() && !cu->TypeUnit)
+            {
+                cu->Dies.Own();
+                cu->Reused = false;
+                this->ReloadUnits.emplace(unitDIE.NameId(), cu);
+            }
+            else
+            {
+                // Nothing resolved yet, as cheap to decode again
+                delete cu;
+            }
+        }
+        this->CompilationUnit.clear();
+
+        this->ResetIndexes();
+        this->CacheFile.close();
+    }
+    else
+    {
+        this->Reset();
+    }
+
+    // Split files of the previous parse, nothing points into them any more
+    this->SplitFiles.clear();
+    this->SplitSections.clear();
+    this->SplitMissing = 0;
+    this->FileName = file_name;
+
+    // Open memory-mapped file, names in both trees point into it until the next Parse() or destruction
+    MappedFile& file = this->File;
+    if (!file.open(file_name))
+    {
+        std::cout << "Failed to open file: " << file_name << "\n";
+        this->DropReloadUnits();
+        return 1;
+    }
+
+    // Store offsets
+    this->StrOffset = StrOffset;
+    this->InfoOffset = InfoOffset;
+    this->InfoLen = InfoLen;
+    this->fileBase = file.data;
+    this->ByteOrder = ByteOrder;
+
+    /* A database of the same file replaces the whole parse, a reload keeps what it can instead */
+    bool reloading = !this->ReloadUnits.empty();
+    bool cached = !reloading && !this->CacheDir.empty() && (this->LoadCache() == 0);
+    uint32_t threadCnt = 0;
+
+    /* A miss with caching on parses fully once even in lazy mode, so the next open finds a database */
+    bool lazy = this->Lazy;
+    if (!cached)
+    {
+        this->Lazy = lazy && this->CacheDir.empty();
+        threadCnt = this->ParseAndResolve(Offset, InfoLen);
+    }
+
+    // Units of the previous parse nothing was taken from
+    this->DropReloadUnits();
+
+    uint32_t cuCnt = static_cast<uint32_t>(CompilationUnit.size());
+    if (cuCnt == 0)
+    {
+        std::cout << "Failefile: " << file_name << "\n";
+        this->Lazy = lazy;
+        return 0;
+    }
+
+    /* Units are found by their full path and by file name */
+    for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        if (!cu->Symbols || (cu->Symbols->nameId == 0))
+        {
+            continue;
+        }
+
+        std::string_view unitName = this->Names.Get(cu->Symbols->nameId);
+        this->SymbolSearch.Add(unitName, cu->Symbols);
+        this->DIESearchRefs.push_back(FileBin_DWARF_DieCursor(cu, 0).Child());
+        this->DIESearch.Add(unitName, &this->DIESearchRefs.back());
+        this->UnitIndex.emplace(unitName, cu);
+
+        size_t sep = unitName.find_last_of("/\\");
+        if (sep != std::string_view::npos)
+        {
+            this->UnitIndex.emplace(unitName.substr(sep + 1), cu);
+        }
+    }
+
+    // In lazy mode the indexes are completed by the first unqualified lookup or search
+    for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        if (cu->SymbolsLoaded)
+        {
+            SearchIndexUnit(cu);
+        }
+    }
+
+    if (!this->Lazy || cached)
+    {
+        this->BuildSymbolIndex();
+    }
+
+    if (cached)
+    {
+        std::cout << "[INFO] Loaded symbols of " << cuCnt << " compilation units from " << CachePath() << "\n";
+    }
+    else
+    {
+        uint32_t reusedCnt = static_cast<uint32_t>(std::count_if(this->CompilationUnit.begin(), this->CompilationUnit.end(),
+                                                                 [](const FileBin_DWARF_CompileUnitType* cu) { return cu->Reused; }));
+
+        std::cout << "[INFO] Parsed " << (this->Lazy ? "unit headers" : "symbols") << " from " << (cuCnt - reusedCnt)
+                  << " compilation units using " << threadCnt << " threads";
+        if (reloading)
+        {
+            std::cout << ", " << reusedCnt << " unchanged units kept";
+        }
+        std::cout << "\n";
+
+        // Lazy parses hold unresolved units, only full ones are worth storing. Split units may show up later
+        if (!this->Lazy && !this->CacheDir.empty() && (this->SplitMissing == 0))
+        {
+            this->SaveCache();
+        }
+    }
+
+    this->Lazy = lazy;
 
 
 
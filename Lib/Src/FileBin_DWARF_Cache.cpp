@@ -0,0 +1,582 @@
+/**
+ *  \file       FileBin_DWARF_Cache.cpp
+ *  \brief      On-disk symbol database of FileBin_DWARF
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+#include "FileBin_DWARF.h"
+#include "FileBin_Hash.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+/* Database layout, host byte order, every block padded to 8 bytes:
+ *   header
+ *   name records (id, length) then the name characters
+ *   per unit: unit record, DIE store columns, spilled sizes, symbol nodes, symbol sizes, type and origin references
+ * Symbol nodes are numbered per unit, node 0 is the unit symbol. Links are node numbers, shared
+ * type layouts are stored once and linked from every user as in memory */
+
+#define FILEBIN_DWARF_CACHE_MAGIC   "FBDWDB\0"
+#define FILEBIN_DWARF_CACHE_BOM     0x01020304u  /* Rejects databases written by a host of the other byte order */
+#define FILEBIN_DWARF_CACHE_ALIGN   8u
+
+typedef struct
+{
+    char Magic[8];
+    uint32_t Version;
+    uint32_t ByteOrderMark;
+    uint64_t Key;
+    uint64_t InfoLen;
+    uint32_t UnitCnt;
+    uint32_t NameCnt;
+    uint64_t NameBytes;
+    uint64_t Checksum;      /* FileBin_Hash64() of everything after the header */
+} FileBin_DWARF_CacheHeaderType;
+
+typedef struct
+{
+    uint32_t Id;
+    uint32_t Len;
+} FileBin_DWARF_CacheNameType;
+
+typedef struct
+{
+    uint64_t Length_Bytes;
+    uint64_t Offset;
+    uint64_t AbrevOffset;
+    uint32_t AddrSize;
+    uint8_t Version;
+    uint8_t UnitType;
+    uint8_t HeaderSize_Byte;
+    uint8_t OffsetSize;
+    uint32_t RowCnt;
+    uint32_t SpillCnt;      /* Rows with spilled sizes */
+    uint32_t SpillValueCnt;
+    uint32_t NodeCnt;
+    uint32_t SizeCnt;
+    uint32_t TypeRefCnt;    /* Rows of the unit typeRefs */
+    uint32_t OriginRefCnt;  /* Rows of the unit originRefs */
+    uint8_t TypeUnit;       /* No symbol nodes, NodeCnt is 0 */
+    uint8_t Reserved[3];
+} FileBin_DWARF_CacheUnitType;
+
+typedef struct
+{
+    uint64_t Addr;
+    uint32_t TypeOffset;
+    uint32_t NameId;
+    uint32_t Next;          /* FILEBIN_DIESTORE_NONE if absent */
+    uint32_t Child;
+    uint32_t SizeStart;     /* First entry in the unit size list */
+    uint32_t SizeCnt;
+    uint8_t DataType;
+    uint8_t ElementType;
+    uint8_t IsQualifier;
+    uint8_t Reserved[5];
+} FileBin_DWARF_CacheNodeType;
+
+static void FileBin_DWARF_CacheWrite(std::string& out, const void* data, size_t len)
+{
+    out.append(static_cast<const char*>(data), len);
+    out.append((FILEBIN_DWARF_CACHE_ALIGN - (len % FILEBIN_DWARF_CACHE_ALIGN)) % FILEBIN_DWARF_CACHE_ALIGN, '\0');
+}
+
+template <typename T>
+static void FileBin_DWARF_CacheWriteArray(std::string& out, const std::vector<T>& data)
+{
+    FileBin_DWARF_CacheWrite(out, data.data(), data.size() * sizeof(T));
+}
+
+template <typename T>
+static void FileBin_DWARF_CacheWriteArray(std::string& out, const FileBin_DIEColumn<T>& data)
+{
+    FileBin_DWARF_CacheWrite(out, data.data(), data.size() * sizeof(T));
+}
+
+/* Bounds checked sequential reads over the mapped database, a failed read poisons the reader.
+ * Blocks are 8-byte aligned in a page aligned mapping, so View() hands out arrays in place */
+typedef struct
+{
+    const uint8_t* Ptr;
+    const uint8_t* End;
+    bool Ok;
+
+    const uint8_t* Take(size_t len)
+    {
+        size_t padded = (len + (FILEBIN_DWARF_CACHE_ALIGN - 1)) & ~static_cast<size_t>(FILEBIN_DWARF_CACHE_ALIGN - 1);
+
+        if (!Ok || (static_cast<size_t>(End - Ptr) < padded))
+        {
+            Ok = false;
+            return nullptr;
+        }
+
+        const uint8_t* data = Ptr;
+        Ptr += padded;
+        return data;
+    }
+
+    template <typename T>
+    bool Read(T* dst, size_t cnt)
+    {
+        const uint8_t* data = Take(cnt * sizeof(T));
+        if (data && (cnt > 0))
+        {
+            memcpy(dst, data, cnt * sizeof(T));
+        }
+        return Ok;
+    }
+
+    template <typename T>
+    const T* View(size_t cnt)
+    {
+        return reinterpret_cast<const T*>(Take(cnt * sizeof(T)));
+    }
+} FileBin_DWARF_CacheReaderType;
+
+void FileBin_DWARF::SetCache(std::string CacheDir, uint64_t Key)
+{
+    this->CacheDir = CacheDir;
+    this->CacheKey = Key;
+}
+
+std::string FileBin_DWARF::CachePath(void) const
+{
+    char name[17];
+    snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(this->CacheKey));
+
+    std::string path = this->CacheDir;
+    if (!path.empty() && (path.back() != '/') && (path.back() != '\\'))
+    {
+        path += '/';
+    }
+
+    return path + name + FILEBIN_DWARF_CACHE_EXTENSION;
+}
+
+uint8_t FileBin_DWARF::SaveCache(void)
+{
+    std::string path = CachePath();
+    std::string tmpPath = path + ".tmp";
+    std::string out; /* Whole database, written at once when the checksum is known */
+
+    // Names, in the order that gives them their ids back when interned
+    std::vector<FileBin_DWARF_CacheNameType> names;
+    std::string nameBytes;
+    this->Names.ForEach([&](uint32_t id, std::string_view name) {
+        names.push_back({ id, static_cast<uint32_t>(name.size()) });
+        nameBytes.append(name.data(), name.size());
+    });
+
+    FileBin_DWARF_CacheHeaderType header = {};
+    memcpy(header.Magic, FILEBIN_DWARF_CACHE_MAGIC, sizeof(header.Magic));
+    header.Version = FILEBIN_DWARF_CACHE_VERSION;
+    header.ByteOrderMark = FILEBIN_DWARF_CACHE_BOM;
+    header.Key = this->CacheKey;
+    header.InfoLen = this->InfoLen;
+    header.UnitCnt = static_cast<uint32_t>(this->CompilationUnit.size());
+    header.NameCnt = static_cast<uint32_t>(names.size());
+    header.NameBytes = nameBytes.size();
+
+    FileBin_DWARF_CacheWrite(out, &header, sizeof(header));
+    FileBin_DWARF_CacheWriteArray(out, names);
+    FileBin_DWARF_CacheWrite(out, nameBytes.data(), nameBytes.size());
+
+    for (const FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        const FileBin_DIEStore& dies = cu->Dies;
+
+        // Symbol nodes numbered in visit order, shared layout nodes once
+        std::vector<const FileBin_DWARF_VarInfoType*> order;
+        std::unordered_map<const FileBin_DWARF_VarInfoType*, uint32_t> index;
+        std::vector<const FileBin_DWARF_VarInfoType*> pending;
+
+        if (cu->Symbols)
+        {
+            index.emplace(cu->Symbols, 0);
+            order.push_back(cu->Symbols);
+            pending.push_back(cu->Symbols);
+        }
+
+        while (!pending.empty())
+        {
+            const FileBin_DWARF_VarInfoType* node = pending.back();
+            pending.pop_back();
+
+            // The unit symbol links to the next unit, that link is rebuilt on load
+            for (const FileBin_DWARF_VarInfoType* link : { node->child, (node == cu->Symbols) ? nullptr : node->next })
+            {
+                if (link && index.emplace(link, static_cast<uint32_t>(order.size())).second)
+                {
+                    order.push_back(link);
+                    pending.push_back(link);
+                }
+            }
+        }
+
+        std::vector<FileBin_DWARF_CacheNodeType> nodes(order.size());
+        std::vector<uint32_t> sizes;
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            const FileBin_DWARF_VarInfoType* node = order[i];
+            FileBin_DWARF_CacheNodeType& rec = nodes[i];
+
+            rec.Addr = node->Addr;
+            rec.TypeOffset = node->TypeOffset;
+            rec.NameId = node->nameId;
+            rec.Next = ((i > 0) && node->next) ? index[node->next] : FILEBIN_DIESTORE_NONE;
+            rec.Child = node->child ? index[node->child] : FILEBIN_DIESTORE_NONE;
+            rec.SizeStart = static_cast<uint32_t>(sizes.size());
+            rec.SizeCnt = static_cast<uint32_t>(node->Size.size());
+            rec.DataType = static_cast<uint8_t>(node->DataType);
+            rec.ElementType = static_cast<uint8_t>(node->elementType);
+            rec.IsQualifier = node->isQualifier ? 1 : 0;
+            sizes.insert(sizes.end(), node->Size.begin(), node->Size.end());
+        }
+
+        std::vector<uint32_t> spillRows;
+        std::vector<uint32_t> spillCounts;
+        std::vector<uint32_t> spillValues;
+        for (const auto& spill : dies.GetDimSpill())
+        {
+            spillRows.push_back(spill.first);
+            spillCounts.push_back(static_cast<uint32_t>(spill.second.size()));
+            spillValues.insert(spillValues.end(), spill.second.begin(), spill.second.end());
+        }
+
+        // References into other units keep their full .debug_info offset, rows and offsets as two arrays each
+        std::vector<uint32_t> typeRefRows, originRefRows;
+        std::vector<uint64_t> typeRefOffsets, originRefOffsets;
+        for (const auto& ref : cu->typeRefs)
+        {
+            typeRefRows.push_back(ref.first);
+            typeRefOffsets.push_back(ref.second);
+        }
+        for (const auto& ref : cu->originRefs)
+        {
+            originRefRows.push_back(ref.first);
+            originRefOffsets.push_back(ref.second);
+        }
+
+        FileBin_DWARF_CacheUnitType unit = {};
+        unit.Length_Bytes = cu->Length_Bytes;
+        unit.Offset = cu->Offset;
+        unit.AbrevOffset = cu->AbrevOffset;
+        unit.AddrSize = cu->AddrSize;
+        unit.Version = cu->Version;
+        unit.UnitType = cu->UnitType;
+        unit.HeaderSize_Byte = cu->HeaderSize_Byte;
+        unit.OffsetSize = cu->OffsetSize;
+        unit.TypeUnit = cu->TypeUnit ? 1 : 0;
+        unit.RowCnt = dies.Rows();
+        unit.SpillCnt = static_cast<uint32_t>(spillRows.size());
+        unit.SpillValueCnt = static_cast<uint32_t>(spillValues.size());
+        unit.NodeCnt = static_cast<uint32_t>(nodes.size());
+        unit.SizeCnt = static_cast<uint32_t>(sizes.size());
+        unit.TypeRefCnt = static_cast<uint32_t>(typeRefRows.size());
+        unit.OriginRefCnt = static_cast<uint32_t>(originRefRows.size());
+
+        FileBin_DWARF_CacheWrite(out, &unit, sizeof(unit));
+        FileBin_DWARF_CacheWriteArray(out, dies.Tag);
+        FileBin_DWARF_CacheWriteArray(out, dies.Flags);
+        FileBin_DWARF_CacheWriteArray(out, dies.Encoding);
+        FileBin_DWARF_CacheWriteArray(out, dies.DimCount);
+        FileBin_DWARF_CacheWriteArray(out, dies.Parent);
+        FileBin_DWARF_CacheWriteArray(out, dies.FirstChild);
+        FileBin_DWARF_CacheWriteArray(out, dies.Sibling);
+        FileBin_DWARF_CacheWriteArray(out, dies.NameId);
+        FileBin_DWARF_CacheWriteArray(out, dies.TypeOffset);
+        FileBin_DWARF_CacheWriteArray(out, dies.Location);
+        FileBin_DWARF_CacheWriteArray(out, dies.Addr);
+        FileBin_DWARF_CacheWriteArray(out, dies.Dims);
+        FileBin_DWARF_CacheWriteArray(out, spillRows);
+        FileBin_DWARF_CacheWriteArray(out, spillCounts);
+        FileBin_DWARF_CacheWriteArray(out, spillValues);
+        FileBin_DWARF_CacheWriteArray(out, nodes);
+        FileBin_DWARF_CacheWriteArray(out, sizes);
+        FileBin_DWARF_CacheWriteArray(out, typeRefRows);
+        FileBin_DWARF_CacheWriteArray(out, typeRefOffsets);
+        FileBin_DWARF_CacheWriteArray(out, originRefRows);
+        FileBin_DWARF_CacheWriteArray(out, originRefOffsets);
+    }
+
+    header.Checksum = FileBin_Hash64(reinterpret_cast<const uint8_t*>(out.data()) + sizeof(header), out.size() - sizeof(header));
+    memcpy(&out[0], &header, sizeof(header));
+
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.close();
+    if (!file)
+    {
+        std::cerr << "[WARNING] Unable to write symbol cache: " << tmpPath << "\n";
+        std::remove(tmpPath.c_str());
+        return 1;
+    }
+
+    // Readers only ever see a complete database
+    std::remove(path.c_str());
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        std::cerr << "[WARNING] Unable to store symbol cache: " << path << "\n";
+        std::remove(tmpPath.c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+uint8_t FileBin_DWARF::LoadCache(void)
+{
+    MappedFile& file = this->CacheFile;
+    std::string path = CachePath();
+
+    if (!file.open(path))
+    {
+        return 1; // Not cached yet
+    }
+
+    FileBin_DWARF_CacheReaderType reader = { file.data, file.data + file.size, true };
+
+    FileBin_DWARF_CacheHeaderType header;
+    if (!reader.Read(&header, 1) ||
+        (memcmp(header.Magic, FILEBIN_DWARF_CACHE_MAGIC, sizeof(header.Magic)) != 0) ||
+        (header.Version != FILEBIN_DWARF_CACHE_VERSION) ||
+        (header.ByteOrderMark != FILEBIN_DWARF_CACHE_BOM) ||
+        (header.Key != this->CacheKey) ||
+        (header.InfoLen != this->InfoLen))
+    {
+        std::cout << "[INFO] Symbol cache out of date: " << path << "\n";
+        file.close();
+        return 2;
+    }
+
+    if (FileBin_Hash64(file.data + sizeof(header), file.size - sizeof(header)) != header.Checksum)
+    {
+        std::cerr << "[WARNING] Corrupt symbol cache ignored: " << path << "\n";
+        file.close();
+        return 3;
+    }
+
+    const FileBin_DWARF_CacheNameType* names = reader.View<FileBin_DWARF_CacheNameType>(header.NameCnt);
+    const uint8_t* nameBytes = reader.Take(header.NameBytes);
+
+    // Names stay in the mapping and go back under the ids the nodes hold, without hashing them
+    uint64_t namePos = 0;
+    for (size_t i = 0; reader.Ok && (i < header.NameCnt); i++)
+    {
+        if ((names[i].Len > header.NameBytes - namePos) ||
+            !this->Names.Restore(names[i].Id, std::string_view(reinterpret_cast<const char*>(nameBytes + namePos), names[i].Len)))
+        {
+            reader.Ok = false;
+        }
+        namePos += names[i].Len;
+    }
+
+    FileBin_DWARF_CompileUnitType* prevUnit = nullptr;
+    FileBin_DWARF_VarInfoType* prevSymbol = nullptr;
+
+    for (uint32_t u = 0; reader.Ok && (u < header.UnitCnt); u++)
+    {
+        FileBin_DWARF_CacheUnitType unit;
+        if (!reader.Read(&unit, 1))
+        {
+            break;
+        }
+
+        FileBin_DWARF_CompileUnitType* cu = new FileBin_DWARF_CompileUnitType();
+        this->CompilationUnit.push_back(cu);
+
+        cu->Length_Bytes = unit.Length_Bytes;
+        cu->Offset = unit.Offset;
+        cu->AbrevOffset = unit.AbrevOffset;
+        cu->AddrSize = unit.AddrSize;
+        cu->Version = unit.Version;
+        cu->UnitType = unit.UnitType;
+        cu->HeaderSize_Byte = unit.HeaderSize_Byte;
+        cu->OffsetSize = unit.OffsetSize;
+        cu->TypeUnit = (unit.TypeUnit != 0);
+        cu->AbbrevInfo = nullptr; /* Every DIE is decoded already */
+
+        // The DIE columns are used in place, the mapping lives as long as the units (see Reload)
+        FileBin_DIEStore& dies = cu->Dies;
+        const uint32_t rows = unit.RowCnt;
+        const uint8_t* tag = reader.View<uint8_t>(rows);
+        const uint8_t* flags = reader.View<uint8_t>(rows);
+        const uint8_t* encoding = reader.View<uint8_t>(rows);
+        const uint8_t* dimCount = reader.View<uint8_t>(rows);
+        const uint32_t* parent = reader.View<uint32_t>(rows);
+        const uint32_t* firstChild = reader.View<uint32_t>(rows);
+        const uint32_t* sibling = reader.View<uint32_t>(rows);
+        const uint32_t* nameId = reader.View<uint32_t>(rows);
+        const uint32_t* typeOffset = reader.View<uint32_t>(rows);
+        const uint32_t* location = reader.View<uint32_t>(rows);
+        const uint64_t* addr = reader.View<uint64_t>(rows);
+        const std::array<uint32_t, FILEBIN_DIESTORE_INLINE_DIMS>* dims = reader.View<std::array<uint32_t, FILEBIN_DIESTORE_INLINE_DIMS>>(rows);
+
+        const uint32_t* spillRows = reader.View<uint32_t>(unit.SpillCnt);
+        const uint32_t* spillCounts = reader.View<uint32_t>(unit.SpillCnt);
+        const uint32_t* spillValues = reader.View<uint32_t>(unit.SpillValueCnt);
+
+        const FileBin_DWARF_CacheNodeType* nodes = reader.View<FileBin_DWARF_CacheNodeType>(unit.NodeCnt);
+        const uint32_t* sizes = reader.View<uint32_t>(unit.SizeCnt);
+
+        const uint32_t* typeRefRows = reader.View<uint32_t>(unit.TypeRefCnt);
+        const uint64_t* typeRefOffsets = reader.View<uint64_t>(unit.TypeRefCnt);
+        const uint32_t* originRefRows = reader.View<uint32_t>(unit.OriginRefCnt);
+        const uint64_t* originRefOffsets = reader.View<uint64_t>(unit.OriginRefCnt);
+
+        if (!reader.Ok || (rows == 0) || ((unit.NodeCnt == 0) != cu->TypeUnit))
+        {
+            reader.Ok = false;
+            break;
+        }
+
+        dies.Tag.Borrow(tag, rows);
+        dies.Flags.Borrow(flags, rows);
+        dies.Encoding.Borrow(encoding, rows);
+        dies.DimCount.Borrow(dimCount, rows);
+        dies.Parent.Borrow(parent, rows);
+        dies.FirstChild.Borrow(firstChild, rows);
+        dies.Sibling.Borrow(sibling, rows);
+        dies.NameId.Borrow(nameId, rows);
+        dies.TypeOffset.Borrow(typeOffset, rows);
+        dies.Location.Borrow(location, rows);
+        dies.Addr.Borrow(addr, rows);
+        dies.Dims.Borrow(dims, rows);
+
+        uint32_t spillPos = 0;
+        for (uint32_t i = 0; i < unit.SpillCnt; i++)
+        {
+            if ((spillRows[i] >= unit.RowCnt) || (spillCounts[i] > unit.SpillValueCnt - spillPos))
+            {
+                reader.Ok = false;
+                break;
+            }
+            dies.SetDimSpill(spillRows[i], spillValues + spillPos, spillCounts[i]);
+            spillPos += spillCounts[i];
+        }
+
+        for (uint32_t i = 0; reader.Ok && (i < unit.TypeRefCnt); i++)
+        {
+            reader.Ok = (typeRefRows[i] < unit.RowCnt);
+            cu->typeRefs[typeRefRows[i]] = typeRefOffsets[i];
+        }
+
+        for (uint32_t i = 0; reader.Ok && (i < unit.OriginRefCnt); i++)
+        {
+            reader.Ok = (originRefRows[i] < unit.RowCnt);
+            cu->originRefs[originRefRows[i]] = originRefOffsets[i];
+        }
+
+        // Symbol nodes go to the unit arena, links are resolved once all exist
+        std::vector<FileBin_DWARF_VarInfoType*> symbols(unit.NodeCnt);
+        for (uint32_t i = 0; i < unit.NodeCnt; i++)
+        {
+            symbols[i] = NewVarInfo(cu);
+        }
+
+        for (uint32_t i = 0; reader.Ok && (i < unit.NodeCnt); i++)
+        {
+            const FileBin_DWARF_CacheNodeType& rec = nodes[i];
+            FileBin_DWARF_VarInfoType* node = symbols[i];
+
+            if (((rec.Next != FILEBIN_DIESTORE_NONE) && (rec.Next >= unit.NodeCnt)) ||
+                ((rec.Child != FILEBIN_DIESTORE_NONE) && (rec.Child >= unit.NodeCnt)) ||
+                (rec.SizeStart > unit.SizeCnt) || (rec.SizeCnt > unit.SizeCnt - rec.SizeStart))
+            {
+                reader.Ok = false;
+                break;
+            }
+
+            node->Addr = rec.Addr;
+            node->TypeOffset = rec.TypeOffset;
+            node->nameId = rec.NameId;
+            node->next = (rec.Next != FILEBIN_DIESTORE_NONE) ? symbols[rec.Next] : nullptr;
+            node->child = (rec.Child != FILEBIN_DIESTORE_NONE) ? symbols[rec.Child] : nullptr;
+            node->DataType = static_cast<FileBin_DWARF_VarInfoLenType>(rec.DataType);
+            node->elementType = static_cast<FileBin_DWARF_ElementType>(rec.ElementType);
+            node->isQualifier = (rec.IsQualifier != 0);
+            node->Size.assign(sizes + rec.SizeStart, sizes + rec.SizeStart + rec.SizeCnt);
+        }
+
+        cu->Symbols = cu->TypeUnit ? nullptr : symbols[0];
+        cu->SymbolsLoaded = true;
+
+        // First definition wins, as when the unit is traversed
+        for (FileBin_DWARF_VarInfoType* var = cu->Symbols ? cu->Symbols->child : nullptr; var != nullptr; var = var->next)
+        {
+            if (var->nameId != 0)
+            {
+                cu->symbolIndex.emplace(var->nameId, var);
+            }
+        }
+
+        if (prevUnit)
+        {
+            prevUnit->NextUnit = cu;
+        }
+        else
+        {
+            this->DataRoot = FileBin_DWARF_DieCursor(cu, 0);
+        }
+        prevUnit = cu;
+
+        // Type units are in the DIE tree only
+        if (!cu->Symbols)
+        {
+            continue;
+        }
+
+        if (prevSymbol)
+        {
+            prevSymbol->next = cu->Symbols;
+        }
+        else
+        {
+            this->SymbolRoot = cu->Symbols;
+        }
+        prevSymbol = cu->Symbols;
+    }
+
+    if (!reader.Ok)
+    {
+        std::cerr << "[WARNING] Corrupt symbol cache ignored: " << path << "\n";
+
+        // Back to a clean state for the regular parse, the mapped input file is kept
+        this->Reset();
+        return 3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,343 @@
+/**
+ *  \file       FileBin_DWARF_Split.cpp
+ *  \brief      Split DWARF (.dwo files and .dwp packages) lookup of FileBin_DWARF
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+#include "FileBin_DWARF.h"
+#include "FileBin_DWARF_Def.h"
+#include "FileBin_ELF.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* Unit index of a package, .debug_cu_index or .debug_tu_index (DWARF 5, or version 2 of the GNU extension):
+ *   header: version, section count N, unit count U, slot count S
+ *   S unit ids (8 bytes) and S rows (4 bytes, 0 for an empty slot) of an open addressing hash table
+ *   N section ids, then U x N contribution offsets and U x N contribution sizes (4 bytes each) */
+typedef struct
+{
+    const uint8_t* Data = nullptr;
+    FileBin_ByteOrder Order = FILEBIN_BYTEORDER_LITTLE;
+    uint32_t SectionCnt = 0;
+    uint32_t UnitCnt = 0;
+    uint32_t SlotCnt = 0;
+
+    uint32_t Load32(uint64_t offset) const { return FileBin_Endian_Load<uint32_t>(Data + offset, Order); }
+
+    bool Parse(const uint8_t* data, uint64_t len, FileBin_ByteOrder order)
+    {
+        Data = data;
+        Order = order;
+        if (!data || (len < 16))
+        {
+            return false;
+        }
+
+        // DWARF 5 has a 2 byte version and 2 bytes of padding, the GNU extension a 4 byte one
+        uint32_t version = Load32(0);
+        if (version != 2)
+        {
+            version = FileBin_Endian_Load<uint16_t>(data, order);
+        }
+
+        SectionCnt = Load32(4);
+        UnitCnt = Load32(8);
+        SlotCnt = Load32(12);
+
+        uint64_t size = 16 + 12ull * SlotCnt + 4ull * SectionCnt + 8ull * UnitCnt * SectionCnt;
+        return ((version == 2) || (version == 5)) && ((SlotCnt & (SlotCnt - 1)) == 0) && (size <= len);
+    }
+
+    /* Row of a unit id, 0 if not in the package */
+    uint32_t Find(uint64_t id) const
+    {
+        if (SlotCnt == 0)
+        {
+            return 0;
+        }
+
+        const uint64_t mask = SlotCnt - 1;
+        const uint64_t step = ((id >> 32) & mask) | 1;
+        uint64_t slot = id & mask;
+
+        for (uint32_t probe = 0; probe < SlotCnt; probe++, slot = (slot + step) & mask)
+        {
+            uint32_t row = Load32(16 + 8ull * SlotCnt + 4 * slot);
+            if (row == 0)
+            {
+                return 0;
+            }
+            if (FileBin_Endian_Load<uint64_t>(Data + 16 + 8 * slot, Order) == id)
+            {
+                return (row <= UnitCnt) ? row : 0;
+            }
+        }
+
+        return 0;
+    }
+
+    /* Part of section sectionId (DW_SECT_*) belonging to the unit of a row */
+    bool Contribution(uint32_t row, uint32_t sectionId, uint64_t& offset, uint64_t& size) const
+    {
+        const uint64_t ids = 16 + 12ull * SlotCnt;
+        const uint64_t offsets = ids + 4ull * SectionCnt;
+        const uint64_t sizes = offsets + 4ull * UnitCnt * SectionCnt;
+
+        for (uint32_t col = 0; col < SectionCnt; col++)
+        {
+            if (Load32(ids + 4 * col) == sectionId)
+            {
+                uint64_t cell = 4ull * ((row - 1) * static_cast<uint64_t>(SectionCnt) + col);
+                offset = Load32(offsets + cell);
+                size = Load32(sizes + cell);
+                return true;
+            }
+        }
+
+        return false;
+    }
+} FileBin_DWARF_PackageIndexType;
+
+static bool fileExists(const std::string& path)
+{
+    return std::ifstream(path, std::ios::binary).is_open();
+}
+
+static std::string joinPath(const std::string& dir, const std::string& name)
+{
+    if (dir.empty() || (dir.back() == '/') || (dir.back() == '\\'))
+    {
+        return dir + name;
+    }
+
+    return dir + '/' + name;
+}
+
+/* .dwo file of a skeleton: where the build left it, else next to the parsed file (tree moved or copied) */
+static std::string splitFilePath(const FileBin_DWARF_CompileUnitType* cu, const std::string& fileName)
+{
+    const std::string& name = cu->DwoName;
+    if (name.empty())
+    {
+        return std::string();
+    }
+
+    bool absolute = (name[0] == '/') || (name[0] == '\\') || ((name.size() > 1) && (name[1] == ':'));
+    size_t fileSep = fileName.find_last_of("/\\");
+    std::string fileDir = (fileSep != std::string::npos) ? fileName.substr(0, fileSep) : std::string();
+    size_t nameSep = name.find_last_of("/\\");
+
+    std::vector<std::string> candidates;
+    if (absolute)
+    {
+        candidates.push_back(name);
+    }
+    else
+    {
+        candidates.push_back(joinPath(cu->CompDir, name));
+        candidates.push_back(joinPath(fileDir, name));
+    }
+    if (nameSep != std::string::npos)
+    {
+        candidates.push_back(joinPath(fileDir, name.substr(nameSep + 1)));
+    }
+
+    for (const std::string& path : candidates)
+    {
+        if (fileExists(path))
+        {
+            return path;
+        }
+    }
+
+    return std::string();
+}
+
+FileBin_DWARF_SplitSectionsType* FileBin_DWARF::AddSplitSections(const FileBin_ELF& file)
+{
+    this->SplitSections.emplace_back();
+    FileBin_DWARF_SplitSectionsType& sections = this->SplitSections.back();
+
+    sections.Data = file.GetFile().data;
+    sections.AbbrevOffset = file.GetAbbrevOffset();
+    sections.StrOffset = file.GetStrOffset();
+    sections.StrOffsetsOffset = file.GetStrOffsetsOffset();
+    sections.StrOffsetsLen = file.GetStrOffsetsLen();
+
+    return &sections;
+}
+
+void FileBin_DWARF::OpenSplitUnits(std::vector<FileBin_DWARF_SplitSourceType>& sources)
+{
+    std::vector<FileBin_DWARF_CompileUnitType*> skeletons;
+    for (FileBin_DWARF_CompileUnitType* cu : this->CompilationUnit)
+    {
+        if (cu->Skeleton)
+        {
+            skeletons.push_back(cu);
+        }
+    }
+
+    // A package holds every split unit, looked up next to the file as "file.dwp" or with the extension replaced
+    std::string package = this->FileName + ".dwp";
+    size_t ext = this->FileName.find_last_of('.');
+    size_t sep = this->FileName.find_last_of("/\\");
+    if (!fileExists(package) && (ext != std::string::npos) && ((sep == std::string::npos) || (ext > sep)))
+    {
+        package = this->FileName.substr(0, ext) + ".dwp";
+    }
+
+    if (fileExists(package) && this->OpenSplitPackage(package, skeletons, sources))
+    {
+        return;
+    }
+
+    // Otherwise each skeleton names its .dwo file, opened concurrently
+    std::vector<std::unique_ptr<FileBin_ELF>> files(skeletons.size());
+    std::vector<uint32_t> weights(skeletons.size(), 1);
+
+    ParallelFor("Split open", weights, [&](uint32_t t) {
+        std::string path = splitFilePath(skeletons[t], this->FileName);
+        if (path.empty())
+        {
+            return;
+        }
+
+        std::unique_ptr<FileBin_ELF> file(new FileBin_ELF());
+        if ((file->Parse(path) == 0) && file->IsDWARF() && (file->GetByteOrder() == this->ByteOrder))
+        {
+            files[t] = std::move(file);
+        }
+    });
+
+    for (uint32_t t = 0; t < skeletons.size(); t++)
+    {
+        if (!files[t])
+        {
+            std::cout << "[WARNING] Split unit not found: " << skeletons[t]->DwoName << "\n";
+            continue;
+        }
+
+        // Type units come in sections of their own next to the split unit, .debug_types.dwo ones in DWARF 4
+        const FileBin_ELF& file = *files[t];
+        FileBin_DWARF_SplitSourceType source;
+        source.Skeleton = skeletons[t];
+        source.Sections = AddSplitSections(file);
+
+        auto addSections = [&](std::string_view name, bool typeSection) {
+            for (const Elf64_Shdr* section : file.GetSections(name))
+            {
+                if (file.GetFile().at(section->sh_offset, section->sh_size))
+                {
+                    source.InfoOffset = section->sh_offset;
+                    source.InfoLen = section->sh_size;
+                    source.TypeSection = typeSection;
+                    sources.push_back(source);
+                }
+            }
+        };
+        addSections(".debug_info.dwo", false);
+        addSections(".debug_types.dwo", true);
+
+        this->SplitFiles.push_back(std::move(files[t]));
+    }
+}
+
+bool FileBin_DWARF::OpenSplitPackage(const std::string& path, const std::vector<FileBin_DWARF_CompileUnitType*>& skeletons,
+                                     std::vector<FileBin_DWARF_SplitSourceType>& sources)
+{
+    std::unique_ptr<FileBin_ELF> package(new FileBin_ELF());
+    FileBin_DWARF_PackageIndexType cuIndex;
+    FileBin_DWARF_PackageIndexType tuIndex;
+
+    if ((package->Parse(path) != 0) || !package->IsDWARF() || (package->GetByteOrder() != this->ByteOrder) ||
+        !cuIndex.Parse(package->GetFile().at(package->GetCuIndexOffset(), package->GetCuIndexLen()), package->GetCuIndexLen(), this->ByteOrder))
+    {
+        std::cout << "[WARNING] Not a DWARF package, ignored: " << path << "\n";
+        return false;
+    }
+
+    const FileBin_ELF& file = *package;
+
+    // Each unit reads its own part of the package sections, units without an abbreviation contribution are unusable
+    auto addUnit = [&](const FileBin_DWARF_PackageIndexType& index, uint32_t row, FileBin_DWARF_CompileUnitType* skeleton) {
+        uint64_t infoOffset = 0, infoLen = 0, abbrevOffset = 0, abbrevLen = 0, strOffset = 0, strLen = 0;
+        bool types = index.Contribution(row, DW_SECT_TYPES, infoOffset, infoLen) && (file.GetTypesLen() > 0);
+
+        if ((!types && !index.Contribution(row, DW_SECT_INFO, infoOffset, infoLen)) ||
+            !index.Contribution(row, DW_SECT_ABBREV, abbrevOffset, abbrevLen))
+        {
+            return;
+        }
+
+        FileBin_DWARF_SplitSectionsType* sections = AddSplitSections(file);
+        sections->AbbrevOffset += abbrevOffset;
+        if (index.Contribution(row, DW_SECT_STR_OFFSETS, strOffset, strLen))
+        {
+            sections->StrOffsetsOffset += strOffset;
+            sections->StrOffsetsLen = strLen;
+        }
+
+        FileBin_DWARF_SplitSourceType source;
+        source.Skeleton = skeleton;
+        source.Sections = sections;
+        source.InfoOffset = (types ? file.GetTypesOffset() : file.GetInfoOffset()) + infoOffset;
+        source.InfoLen = infoLen;
+        source.TypeSection = types;
+        sources.push_back(source);
+    };
+
+    for (FileBin_DWARF_CompileUnitType* skeleton : skeletons)
+    {
+        uint32_t row = cuIndex.Find(skeleton->DwoId);
+        if (row == 0)
+        {
+            std::cout << "[WARNING] Split unit not in package: " << skeleton->DwoName << "\n";
+            continue;
+        }
+
+        addUnit(cuIndex, row, skeleton);
+    }
+
+    // Type units of the package, each signature is stored once
+    if ((package->GetTuIndexLen() > 0) &&
+        tuIndex.Parse(package->GetFile().at(package->GetTuIndexOffset(), package->GetTuIndexLen()), package->GetTuIndexLen(), this->ByteOrder))
+    {
+        for (uint32_t row = 1; row <= tuIndex.UnitCnt; row++)
+        {
+            addUnit(tuIndex, row, nullptr);
+        }
+    }
+
+    this->SplitFiles.push_back(std::move(package));
+    return true;
+}
@@ -33,92 +33,17 @@
 #include "FileBin_ELF.h"
 #include "FileBin_ELF_Def.h"
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <iomanip>    // for std::setw and std::setfill
 
-#if defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#else
-#include <sys/mman.h>
-#include <sys/stat.h>
-#include <fcntl.h>
-#include <unistd.h>
-#endif
-
 using namespace std;
 
-class MappedFile
-{
-public:
-    const uint8_t* data = nullptr;
-    size_t size = 0;
-
-#if defined(_WIN32) || defined(_WIN64)
-private:
-    HANDLE hFile = INVALID_HANDLE_VALUE;
-    HANDLE hMap = NULL;
-#else
-private:
-    int fd = -1;
-#endif
-
-public:
-    bool open(const std::string& fileName)
-    {
-#if defined(_WIN32) || defined(_WIN64)
-        hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
-                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-        if (hFile == INVALID_HANDLE_VALUE) return false;
-
-        LARGE_INTEGER fsize;
-        if (!GetFileSizeEx(hFile, &fsize)) return false;
-        size = static_cast<size_t>(fsize.QuadPart);
-
-        hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
-        if (!hMap) return false;
-
-        data = static_cast<const uint8_t*>(MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
-        if (!data) return false;
-
-#else
-        fd = ::open(fileName.c_str(), O_RDONLY);
-        if (fd < 0) return false;
-
-        struct stat st;
-        if (fstat(fd, &st) < 0) return false;
-        size = st.st_size;
-
-        data = static_cast<const uint8_t*>(mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
-        if (data == MAP_FAILED) return false;
-#endif
-        return true;
-    }
-
-    void close()
-    {
-#if defined(_WIN32) || defined(_WIN64)
-        if (data) UnmapViewOfFile(data);
-        if (hMap) CloseHandle(hMap);
-        if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
-#else
-        if (data) munmap((void*)data, size);
-        if (fd >= 0) ::close(fd);
-#endif
-        data = nullptr;
-        size = 0;
-    }
-
-    ~MappedFile()
-    {
-        close();
-    }
-};
-
 FileBin_ELF::FileBin_ELF()
 {
 }
 
-std::string FileBin_ELF::GetStr_ElfClass(const Elf32_Ehdr *elf_header) const
+std::string FileBin_ELF::GetStr_ElfClass(const Elf64_Ehdr *elf_header) const
 {
     std::string elf_header_ident_class_str;
     switch (elf_header->e_ident[EI_CLASS])
@@ -130,7 +55,7 @@ std::string FileBin_ELF::GetStr_ElfClass(const Elf32_Ehdr *elf_header) const
     return elf_header_ident_class_str;
 }
 
-std::string FileBin_ELF::GetStr_ElfDataEncoding(const Elf32_Ehdr *elf_header) const
+std::string FileBin_ELF::GetStr_ElfDataEncoding(const Elf64_Ehdr *elf_header) const
 {
     std::string elf_header_ident_data_str;
     switch (elf_header->e_ident[EI_DATA])
@@ -142,7 +67,7 @@ std::string FileBin_ELF::GetStr_ElfDataEncoding(const Elf32_Ehdr *elf_header) co
     return elf_header_ident_data_str;
 }
 
-std::string FileBin_ELF::GetStr_ElfOSABI(const Elf32_Ehdr *elf_header) const
+std::string FileBin_ELF::GetStr_ElfOSABI(const Elf64_Ehdr *elf_header) const
 {
     std::string elf_header_ident_osabi_str;
     switch (elf_header->e_ident[EI_OSABI])
@@ -166,7 +91,7 @@ std::string FileBin_ELF::GetStr_ElfOSABI(const Elf32_Ehdr *elf_header) const
     return elf_header_ident_osabi_str;
 }
 
-std::string FileBin_ELF::GetStr_ElfType(const Elf32_Ehdr *elf_header) const
+std::string FileBin_ELF::GetStr_ElfType(const Elf64_Ehdr *elf_header) const
 {
     std::string elf_header_type_str;
     switch (elf_header->e_type)
@@ -186,7 +111,7 @@ std::string FileBin_ELF::GetStr_ElfType(const Elf32_Ehdr *elf_header) const
     return elf_header_type_str;
 }
 
-std::string FileBin_ELF::GetStr_ElfMachine(const Elf32_Ehdr *elf_header) const
+std::string FileBin_ELF::GetStr_ElfMachine(const Elf64_Ehdr *elf_header) const
 {
     std::string elf_header_machine_str ;
     switch (elf_header->e_machine)
@@ -275,7 +200,7 @@ std::string FileBin_ELF::GetStr_ElfMachine(const Elf32_Ehdr *elf_header) const
     return elf_header_machine_str;
 }
 
-string FileBin_ELF::GetStr_SectionHeader(const Elf32_Shdr *section_header) const
+string FileBin_ELF::GetStr_SectionHeader(const Elf64_Shdr *section_header) const
 {
     string section_header_type_str ;
 
@@ -320,7 +245,7 @@ string FileBin_ELF::GetStr_SectionHeader(const Elf32_Shdr *section_header) const
     return section_header_type_str;
 }
 
-void FileBin_ELF::PrintElfHeader(const Elf32_Ehdr *elf_header) const
+void FileBin_ELF::PrintElfHeader(const Elf64_Ehdr *elf_header) const
 {
     cout << "Class: " << GetStr_ElfClass(elf_header) << endl;               /* e_ident[EI_CLASS] */
     cout << "Encoding: " << GetStr_ElfDataEncoding(elf_header) << endl;     /* e_ident[EI_DATA] */
@@ -373,6 +298,22 @@ void FileBin_ELF::Print(void) const
         cout << ".debug_info section found at " << std::hex << this->InfoOffset << endl;
         cout << ".debug_str section found at " << std::hex << this->StrOffset << endl;
     }
+    if (this->StrOffsetsLen > 0)
+    {
+        cout << ".debug_str_offsets section found at " << std::hex << this->StrOffsetsOffset << endl;
+    }
+    if (this->AddrLen > 0)
+    {
+        cout << ".debug_addr section found at " << std::hex << this->AddrOffset << endl;
+    }
+    if (this->TypesLen > 0)
+    {
+        cout << ".debug_types section found at " << std::hex << this->TypesOffset << endl;
+    }
+    if (this->CuIndexLen > 0)
+    {
+        cout << ".debug_cu_index section found at " << std::hex << this->CuIndexOffset << endl;
+    }
 
     cout << "Section header count: " <<  this->SectionNameStr.size() << endl;
      std::string section_header_type_str ;
@@ -383,14 +324,17 @@ void FileBin_ELF::Print(void) const
     }
 }
 
-std::vector<SectionMapEntry> FileBin_ELF::buildSectionMap(const std::vector<Elf32_Shdr>& section_headers) {
+std::vector<SectionMapEntry> FileBin_ELF::buildSectionMap(const std::vector<Elf64_Shdr>& section_headers) {
     std::vector<SectionMapEntry> map;
     for (const auto& sh : section_headers) {
         if (sh.sh_size == 0) continue;
+        // Only sections occupying target memory have a meaningful VA (.debug_* all sit at 0)
+        if (!(sh.sh_flags & SHF_ALLOC)) continue;
         SectionMapEntry entry;
         entry.vaStart = sh.sh_addr;
         entry.vaEnd = sh.sh_addr + sh.sh_size;
         entry.fileOffset = sh.sh_offset;
+        entry.fileSize = (sh.sh_type == SHT_NOBITS) ? 0 : sh.sh_size;
         map.push_back(entry);
     }
 
@@ -402,7 +346,7 @@ std::vector<SectionMapEntry> FileBin_ELF::buildSectionMap(const std::vector<Elf3
     return map;
 }
 
-const SectionMapEntry* FileBin_ELF::findSectionForVA(uint32_t va) {
+const SectionMapEntry* FileBin_ELF::findSectionForVA(uint64_t va) const {
     size_t left = 0;
     size_t right = this->sectionMap.size();
 
@@ -419,96 +363,361 @@ const SectionMapEntry* FileBin_ELF::findSectionForVA(uint32_t va) {
     return nullptr; // Not found
 }
 
-std::vector<uint8_t> FileBin_ELF::readSymbolFromELF(
-                                       uint32_t symbolVA,
-                                       uint32_t symbolSize)
+const uint8_t* FileBin_ELF::readSymbolView(uint64_t symbolVA, uint32_t symbolSize) const
 {
+    const SectionMapEntry* sec = findSectionForVA(symbolVA);
+    if (!sec) {
+        std::cerr << "[ERROR] Symbol VA 0x" << std::hex << symbolVA << std::dec << " not in any section\n";
+        return nullptr;
+    }
 
-    this->file_descriptor = fopen(this->File_Name.c_str(), "rb");
-    if (!this->file_descriptor)
-    {
-        std::cout << "[ERROR] Unable to open ELF file: " << this->File_Name << std::endl;
-        //return 1;
+    // Symbol must be fully backed by file contents (.bss and friends have no initial value)
+    uint64_t sectionOffset = symbolVA - sec->vaStart;
+    if ((sectionOffset > sec->fileSize) || (symbolSize > (sec->fileSize - sectionOffset))) {
+        return nullptr;
     }
 
-    const SectionMapEntry* sec = findSectionForVA(symbolVA);
-    if (!sec) {
-        std::cerr << "[ERROR] Symbol VA 0x" << std::hex << symbolVA << " not in any section\n";
+    return this->File.at(sec->fileOffset + sectionOffset, symbolSize);
+}
+
+std::vector<uint8_t> FileBin_ELF::readSymbolFromELF(
+                                       uint64_t symbolVA,
+                                       uint32_t symbolSize) const
+{
+    const uint8_t* view = readSymbolView(symbolVA, symbolSize);
+    if (!view) {
         return {};
     }
 
-    uint32_t fileOffset = sec->fileOffset + (symbolVA - sec->vaStart);
-    std::vector<uint8_t> buffer(symbolSize);
+    return std::vector<uint8_t>(view, view + symbolSize);
+}
 
-    if (fseek(this->file_descriptor, fileOffset, SEEK_SET) != 0) {
-        std::cerr << "[ERROR] fseek failed\n";
-        return {};
+void FileBin_ELF::readSymbolsFromELF(std::vector<SymbolReadRequest>& requests) const
+{
+    // Visit requests in address order, keeping caller order for the results
+    std::vector<uint32_t> order(requests.size());
+    for (uint32_t i = 0; i < order.size(); i++) {
+        order[i] = i;
     }
+    std::sort(order.begin(), order.end(), [&requests](uint32_t a, uint32_t b) {
+        return requests[a].va < requests[b].va;
+    });
 
-    if (fread(buffer.data(), 1, symbolSize, this->file_descriptor) != symbolSize) {
-        std::cerr << "[ERROR] fread failed\n";
-        return {};
+    // Single merge pass over the (VA sorted) section map instead of one search per symbol
+    size_t secIdx = 0;
+    for (uint32_t idx : order) {
+        SymbolReadRequest& req = requests[idx];
+        req.data = nullptr;
+
+        while ((secIdx < this->sectionMap.size()) && (req.va >= this->sectionMap[secIdx].vaEnd)) {
+            secIdx++;
+        }
+
+        if ((secIdx == this->sectionMap.size()) || (req.va < this->sectionMap[secIdx].vaStart)) {
+            continue;
+        }
+
+        const SectionMapEntry& sec = this->sectionMap[secIdx];
+        uint64_t sectionOffset = req.va - sec.vaStart;
+        if ((sectionOffset > sec.fileSize) || (req.size > (sec.fileSize - sectionOffset))) {
+            continue;
+        }
+
+        req.data = this->File.at(sec.fileOffset + sectionOffset, req.size);
     }
+}
 
-    fclose(file_descriptor);
+/* Field wise copies into the 64-bit host order layout. Source bytes may be unaligned inside the mapping */
+template <typename Ehdr, FileBin_ByteOrder Order>
+static Elf64_Ehdr FileBin_ELF_NormalizeEhdr(const uint8_t* raw)
+{
+    typedef FileBin_Endian<Order> E;
+    Ehdr hdr;
+    memcpy(&hdr, raw, sizeof(hdr));
+
+    Elf64_Ehdr out;
+    memcpy(out.e_ident, hdr.e_ident, EI_NIDENT);
+    out.e_type      = E::Native(hdr.e_type);
+    out.e_machine   = E::Native(hdr.e_machine);
+    out.e_version   = E::Native(hdr.e_version);
+    out.e_entry     = E::Native(hdr.e_entry);
+    out.e_phoff     = E::Native(hdr.e_phoff);
+    out.e_shoff     = E::Native(hdr.e_shoff);
+    out.e_flags     = E::Native(hdr.e_flags);
+    out.e_ehsize    = E::Native(hdr.e_ehsize);
+    out.e_phentsize = E::Native(hdr.e_phentsize);
+    out.e_phnum     = E::Native(hdr.e_phnum);
+    out.e_shentsize = E::Native(hdr.e_shentsize);
+    out.e_shnum     = E::Native(hdr.e_shnum);
+    out.e_shstrndx  = E::Native(hdr.e_shstrndx);
+    return out;
+}
 
-    return buffer;
+template <typename Shdr, FileBin_ByteOrder Order>
+static Elf64_Shdr FileBin_ELF_NormalizeShdr(const uint8_t* raw)
+{
+    typedef FileBin_Endian<Order> E;
+    Shdr hdr;
+    memcpy(&hdr, raw, sizeof(hdr));
+
+    Elf64_Shdr out;
+    out.sh_name      = E::Native(hdr.sh_name);
+    out.sh_type      = E::Native(hdr.sh_type);
+    out.sh_flags     = E::Native(hdr.sh_flags);
+    out.sh_addr      = E::Native(hdr.sh_addr);
+    out.sh_offset    = E::Native(hdr.sh_offset);
+    out.sh_size      = E::Native(hdr.sh_size);
+    out.sh_link      = E::Native(hdr.sh_link);
+    out.sh_info      = E::Native(hdr.sh_info);
+    out.sh_addralign = E::Native(hdr.sh_addralign);
+    out.sh_entsize   = E::Native(hdr.sh_entsize);
+    return out;
 }
 
 uint8_t FileBin_ELF::Parse(const std::string& file_name)
 {
     /* Clear symbol list */
     this->SectionNameStr.clear();
+    this->SectionHeader.clear();
     this->debugInfoAbbrevFound = false;
     this->debugInfoInfoFound = false;
     this->debugInfoStrFound = false;
+    this->SymbolSectionIdx = 0;
+    this->SymbolStringSectionIdx = 0;
+    this->sectionMap.clear();
+    this->Symbol.clear();
+    this->SymbolByName.clear();
+    this->SymbolEndMax.clear();
+    this->BuildIdOffset = 0;
+    this->BuildIdLen = 0;
+    this->LineStrOffset = this->LineStrLen = 0;
+    this->StrOffsetsOffset = this->StrOffsetsLen = 0;
+    this->AddrOffset = this->AddrLen = 0;
+    this->TypesOffset = this->TypesLen = 0;
+    this->CuIndexOffset = this->CuIndexLen = 0;
+    this->TuIndexOffset = this->TuIndexLen = 0;
     this->File_Name = file_name;
 
-    // Open memory-mapped file
-    MappedFile file;
+    // Open memory-mapped file, it stays mapped until the next Parse() or destruction
+    MappedFile& file = this->File;
     if (!file.open(file_name)) {
         std::cout << "[ERROR] Unable to open ELF file: " << file_name << std::endl;
         return 1;
     }
 
-    if (file.size < sizeof(Elf32_Ehdr)) {
+    if ((file.size < EI_NIDENT) || (memcmp(file.data, ELFMAG, SELFMAG) != 0)) {
+        std::cout << "[ERROR] Not an ELF file: " << file_name << std::endl;
+        return 2;
+    }
+
+    switch (file.data[EI_DATA])
+    {
+        case ELFDATA2LSB: this->ByteOrder = FILEBIN_BYTEORDER_LITTLE; break;
+        case ELFDATA2MSB: this->ByteOrder = FILEBIN_BYTEORDER_BIG; break;
+        default:
+            std::cout << "[ERROR] Invalid ELF data encoding: " << (int)file.data[EI_DATA] << std::endl;
+            return 2;
+    }
+
+    // Pick the 32/64-bit layout and byte order once, everything after header normalization is agnostic of both
+    switch (file.data[EI_CLASS])
+    {
+        case ELFCLASS32:
+            return (this->ByteOrder == FILEBIN_BYTEORDER_BIG) ? this->ParseClass<FileBin_ELF_Class32, FILEBIN_BYTEORDER_BIG>()
+                                                              : this->ParseClass<FileBin_ELF_Class32, FILEBIN_BYTEORDER_LITTLE>();
+        case ELFCLASS64:
+            return (this->ByteOrder == FILEBIN_BYTEORDER_BIG) ? this->ParseClass<FileBin_ELF_Class64, FILEBIN_BYTEORDER_BIG>()
+                                                              : this->ParseClass<FileBin_ELF_Class64, FILEBIN_BYTEORDER_LITTLE>();
+        default:
+            std::cout << "[ERROR] Invalid ELF class: " << (int)file.data[EI_CLASS] << std::endl;
+            return 2;
+    }
+}
+
+template <typename ElfClass, FileBin_ByteOrder Order>
+uint8_t FileBin_ELF::ParseClass(void)
+{
+    typedef typename ElfClass::Ehdr Ehdr;
+    typedef typename ElfClass::Shdr Shdr;
+    typedef typename ElfClass::Phdr Phdr;
+
+    const MappedFile& file = this->File;
+
+    if (file.size < sizeof(Ehdr)) {
         std::cout << "[ERROR] File too small for ELF header" << std::endl;
         return 2;
     }
 
     // Read ELF header directly from mapped memory
-    elf_header = *reinterpret_cast<const Elf32_Ehdr*>(file.data);
+    elf_header = FileBin_ELF_NormalizeEhdr<Ehdr, Order>(file.data);
 
     // Validate ELF header
-    if (elf_header.e_phnum * sizeof(Elf32_Phdr) + elf_header.e_phoff > file.size ||
-        elf_header.e_shnum * sizeof(Elf32_Shdr) + elf_header.e_shoff > file.size)
+    if ((uint64_t)elf_header.e_phnum * sizeof(Phdr) + elf_header.e_phoff > file.size ||
+        (uint64_t)elf_header.e_shnum * sizeof(Shdr) + elf_header.e_shoff > file.size ||
+        (elf_header.e_shnum > 0 && elf_header.e_shentsize != sizeof(Shdr)))
     {
         std::cout << "[ERROR] Invalid ELF header offsets" << std::endl;
         return 3;
     }
 
-    // Read program headers and section headers directly
-    const Elf32_Phdr* program_header = reinterpret_cast<const Elf32_Phdr*>(file.data + elf_header.e_phoff);
-    const Elf32_Shdr* section_header = reinterpret_cast<const Elf32_Shdr*>(file.data + elf_header.e_shoff);
-
-    // Identify string section and symbol tables
+    // Section headers in the common 64-bit layout
+    const uint8_t* section_header = file.data + elf_header.e_shoff;
+    this->SectionHeader.resize(elf_header.e_shnum);
     for (uint32_t i = 0; i < elf_header.e_shnum; ++i)
     {
-        if (i == elf_header.e_shstrndx) {
-            string_section = section_header[i];
+        this->SectionHeader[i] = FileBin_ELF_NormalizeShdr<Shdr, Order>(section_header + i * sizeof(Shdr));
+    }
+
+    uint8_t ret = this->ParseSections();
+    if (ret == 0)
+    {
+        this->ParseSymbols<ElfClass, Order>();
+    }
+
+    return ret;
+}
+
+template <typename ElfClass, FileBin_ByteOrder Order>
+void FileBin_ELF::ParseSymbols(void)
+{
+    typedef typename ElfClass::Sym Sym;
+    typedef FileBin_Endian<Order> E;
+
+    const MappedFile& file = this->File;
+
+    if (this->SymbolSectionIdx == 0)
+    {
+        return; // Stripped image
+    }
+
+    const Elf64_Shdr& symtab = this->SectionHeader[this->SymbolSectionIdx];
+    const Elf64_Shdr& strtab = this->SectionHeader[this->SymbolStringSectionIdx];
+
+    if ((symtab.sh_offset + symtab.sh_size > file.size) || (strtab.sh_offset + strtab.sh_size > file.size))
+    {
+        std::cerr << "[ERROR] Invalid symbol table offset/size" << std::endl;
+        return;
+    }
+
+    const uint8_t* symData = file.data + symtab.sh_offset;
+    const char* strData = reinterpret_cast<const char*>(file.data + strtab.sh_offset);
+    uint64_t symCnt = symtab.sh_size / sizeof(Sym);
+
+    this->Symbol.reserve(symCnt);
+
+    // Entry 0 is the reserved undefined symbol
+    for (uint64_t i = 1; i < symCnt; ++i)
+    {
+        Sym sym;
+        memcpy(&sym, symData + i * sizeof(Sym), sizeof(sym));
+
+        uint32_t nameIdx = E::Native(sym.st_name);
+        uint16_t shndx = E::Native(sym.st_shndx);
+        uint8_t type = ELF32_ST_TYPE(sym.st_info);
+
+        // Only keep symbols that name something with an address
+        if ((shndx == SHN_UNDEF) || (type == STT_SECTION) || (type == STT_FILE) ||
+            (nameIdx == 0) || (nameIdx >= strtab.sh_size))
+        {
+            continue;
         }
-        else if (section_header[i].sh_type == SHT_STRTAB) {
-            symbol_string_section_header = &section_header[i];
+
+        FileBin_ELF_SymbolType entry;
+        entry.Name = std::string_view(strData + nameIdx, strnlen(strData + nameIdx, strtab.sh_size - nameIdx));
+        entry.Addr = E::Native(sym.st_value);
+        entry.Size = E::Native(sym.st_size);
+        entry.Type = type;
+        entry.Bind = ELF32_ST_BIND(sym.st_info);
+        entry.SectionIdx = shndx;
+        this->Symbol.push_back(entry);
+    }
+
+    std::stable_sort(this->Symbol.begin(), this->Symbol.end(), [](const FileBin_ELF_SymbolType& a, const FileBin_ELF_SymbolType& b) {
+        return a.Addr < b.Addr;
+    });
+
+    // Lets address lookups stop walking back as soon as no earlier symbol reaches the address
+    this->SymbolEndMax.resize(this->Symbol.size());
+    uint64_t endMax = 0;
+    for (size_t i = 0; i < this->Symbol.size(); ++i)
+    {
+        endMax = std::max(endMax, this->Symbol[i].Addr + this->Symbol[i].Size);
+        this->SymbolEndMax[i] = endMax;
+    }
+
+    // Name index, a global definition wins over file local symbols sharing its name
+    this->SymbolByName.reserve(this->Symbol.size());
+    for (uint32_t i = 0; i < this->Symbol.size(); ++i)
+    {
+        auto it = this->SymbolByName.emplace(this->Symbol[i].Name, i);
+        if (!it.second && (this->Symbol[i].Bind == STB_GLOBAL) && (this->Symbol[it.first->second].Bind != STB_GLOBAL))
+        {
+            it.first->second = i;
+        }
+    }
+}
+
+const std::vector<FileBin_ELF_SymbolType>& FileBin_ELF::GetSymbols(void) const
+{
+    return this->Symbol;
+}
+
+const FileBin_ELF_SymbolType* FileBin_ELF::FindSymbolByName(std::string_view name) const
+{
+    auto it = this->SymbolByName.find(name);
+
+    return (it != this->SymbolByName.end()) ? &this->Symbol[it->second] : nullptr;
+}
+
+const FileBin_ELF_SymbolType* FileBin_ELF::FindSymbolByAddr(uint64_t addr) const
+{
+    // First symbol starting after addr, candidates are before it
+    auto it = std::upper_bound(this->Symbol.begin(), this->Symbol.end(), addr, [](uint64_t va, const FileBin_ELF_SymbolType& sym) {
+        return va < sym.Addr;
+    });
+
+    // Walk back while a symbol could still cover addr, every one before it ends at or below addr past SymbolEndMax
+    while (it != this->Symbol.begin())
+    {
+        --it;
+
+        if ((addr == it->Addr) || ((addr - it->Addr) < it->Size))
+        {
+            return &(*it);
+        }
+
+        if (this->SymbolEndMax[it - this->Symbol.begin()] <= addr)
+        {
+            break;
         }
+    }
+
+    return nullptr;
+}
+
+uint8_t FileBin_ELF::ParseSections(void)
+{
+    const MappedFile& file = this->File;
+    const std::vector<Elf64_Shdr>& section_header = this->SectionHeader;
 
-        if (section_header[i].sh_type == SHT_SYMTAB) {
-            symbol_section_header = &section_header[i];
+    if (elf_header.e_shstrndx >= section_header.size()) {
+        std::cerr << "[ERROR] Invalid section name string table index" << std::endl;
+        return 4;
+    }
+
+    // Identify symbol table, its string table is given by sh_link
+    for (uint32_t i = 0; i < section_header.size(); ++i)
+    {
+        if ((section_header[i].sh_type == SHT_SYMTAB) && (section_header[i].sh_link < section_header.size())) {
+            SymbolSectionIdx = i;
+            SymbolStringSectionIdx = section_header[i].sh_link;
         }
     }
 
-    sectionMap = buildSectionMap(std::vector<Elf32_Shdr>(section_header, section_header + elf_header.e_shnum));
+    sectionMap = buildSectionMap(section_header);
 
     // Load string table
+    const Elf64_Shdr& string_section = section_header[elf_header.e_shstrndx];
     if (string_section.sh_offset + string_section.sh_size > file.size) {
         std::cerr << "[ERROR] Invalid string table offset/size" << std::endl;
         return 4;
@@ -516,18 +725,44 @@ uint8_t FileBin_ELF::Parse(const std::string& file_name)
 
     const uint8_t* string_table = file.data + string_section.sh_offset;
     // Parse sections
-    for (uint32_t i = 0; i < elf_header.e_shnum; ++i)
+    for (uint32_t i = 0; i < section_header.size(); ++i)
     {
         SectionInfoType sectionInfo;
-        if (section_header[i].sh_type != SHT_NULL)
-            sectionInfo.Name = reinterpret_cast<const char*>(string_table + section_header[i].sh_name);
+        if ((section_header[i].sh_type != SHT_NULL) && (section_header[i].sh_name < string_section.sh_size))
+            sectionInfo.Name = std::string(reinterpret_cast<const char*>(string_table + section_header[i].sh_name),
+                                           strnlen(reinterpret_cast<const char*>(string_table + section_header[i].sh_name),
+                                                   string_section.sh_size - section_header[i].sh_name));
 
         bool parseHeaderData = (section_header[i].sh_type == SHT_PROGBITS);
         SectionNameStr.push_back(sectionInfo);
 
+        if ((section_header[i].sh_type == SHT_NOTE) && (sectionInfo.Name == ".note.gnu.build-id"))
+        {
+            // Single note: namesz, descsz, type, then the "GNU" name and the id, each padded to 4 bytes
+            const uint8_t* note = file.at(section_header[i].sh_offset, sizeof(Elf64_Nhdr));
+            if (note)
+            {
+                uint32_t nameSize = FileBin_Endian_Load<uint32_t>(note, this->ByteOrder);
+                uint32_t descSize = FileBin_Endian_Load<uint32_t>(note + 4, this->ByteOrder);
+                uint32_t type     = FileBin_Endian_Load<uint32_t>(note + 8, this->ByteOrder);
+                uint64_t descOffset = section_header[i].sh_offset + sizeof(Elf64_Nhdr) + ((static_cast<uint64_t>(nameSize) + 3u) & ~3ull);
+
+                if ((type == NT_GNU_BUILD_ID) && (descSize > 0) && file.at(descOffset, descSize))
+                {
+                    BuildIdOffset = descOffset;
+                    BuildIdLen = descSize;
+                }
+            }
+        }
+
         if (parseHeaderData)
         {
-            const std::string& name = sectionInfo.Name;
+            // Split DWARF files (.dwo, .dwp) hold the same sections under a .dwo suffix
+            std::string_view name = sectionInfo.Name;
+            if ((name.size() > 4) && (name.substr(name.size() - 4) == ".dwo")) {
+                name.remove_suffix(4);
+            }
+
             if (name == ".debug_abbrev") {
                 debugInfoAbbrevFound = true;
                 AbbrevOffset = section_header[i].sh_offset;
@@ -539,16 +774,57 @@ uint8_t FileBin_ELF::Parse(const std::string& file_name)
             } else if (name == ".debug_str") {
                 debugInfoStrFound = true;
                 StrOffset = section_header[i].sh_offset;
+            } else if (name == ".debug_line_str") {
+                LineStrOffset = section_header[i].sh_offset;
+                LineStrLen = section_header[i].sh_size;
+            } else if (name == ".debug_str_offsets") {
+                StrOffsetsOffset = section_header[i].sh_offset;
+                StrOffsetsLen = section_header[i].sh_size;
+            } else if (name == ".debug_addr") {
+                AddrOffset = section_header[i].sh_offset;
+                AddrLen = section_header[i].sh_size;
+            } else if (name == ".debug_types") {
+                TypesOffset = section_header[i].sh_offset;
+                TypesLen = section_header[i].sh_size;
+            } else if (name == ".debug_cu_index") {
+                CuIndexOffset = section_header[i].sh_offset;
+                CuIndexLen = section_header[i].sh_size;
+            } else if (name == ".debug_tu_index") {
+                TuIndexOffset = section_header[i].sh_offset;
+                TuIndexLen = section_header[i].sh_size;
             }
         }
     }
 
-    // The file remains mapped; file.data points to ELF contents
-    // No need to fclose; the destructor of MappedFile handles unmapping
+    // The file remains mapped; file.data points to ELF contents until the next Parse()
 
     return 0;
 }
 
+uint64_t FileBin_ELF::GetContentKey(void) const
+{
+    const MappedFile& file = this->File;
+
+    if (this->BuildIdLen > 0)
+    {
+        // Seeded apart from the whole file hash, so an id and a file of the same bytes do not share a key.
+        // The file size tells apart copies that keep the id but differ in content (stripped, converted)
+        return FileBin_Hash64(file.data + this->BuildIdOffset, this->BuildIdLen, NT_GNU_BUILD_ID ^ (static_cast<uint64_t>(file.size) << 8));
+    }
+
+    return FileBin_Hash64(file.data, file.size);
+}
+
+bool FileBin_ELF::Is64Bit(void) const
+{
+    return (elf_header.e_ident[EI_CLASS] == ELFCLASS64);
+}
+
+FileBin_ByteOrder FileBin_ELF::GetByteOrder(void) const
+{
+    return this->ByteOrder;
+}
+
 
 #if(0)
 uint8_t FileBin_ELF::Parse(const std::string& file_name)
@@ -788,27 +1064,106 @@ bool FileBin_ELF::IsDWARF(void) const
 }
 
 
-uint32_t FileBin_ELF::GetAbbrevOffset(void) const
+uint64_t FileBin_ELF::GetAbbrevOffset(void) const
 {
     return AbbrevOffset;
 }
 
-uint32_t FileBin_ELF::GetAbbrevLen(void) const
+uint64_t FileBin_ELF::GetAbbrevLen(void) const
 {
     return AbbrevLen;
 }
 
-uint32_t FileBin_ELF::GetInfoOffset(void) const
+uint64_t FileBin_ELF::GetInfoOffset(void) const
 {
     return InfoOffset;
 }
 
-uint32_t FileBin_ELF::GetInfoLen(void) const
+uint64_t FileBin_ELF::GetInfoLen(void) const
 {
     return InfoLen;
 }
 
-uint32_t FileBin_ELF::GetStrOffset(void) const
+uint64_t FileBin_ELF::GetStrOffset(void) const
 {
     return StrOffset;
 }
+
+uint64_t FileBin_ELF::GetLineStrOffset(void) const
+{
+    return LineStrOffset;
+}
+
+uint64_t FileBin_ELF::GetLineStrLen(void) const
+{
+    return LineStrLen;
+}
+
+uint64_t FileBin_ELF::GetStrOffsetsOffset(void) const
+{
+    return StrOffsetsOffset;
+}
+
+uint64_t FileBin_ELF::GetStrOffsetsLen(void) const
+{
+    return StrOffsetsLen;
+}
+
+uint64_t FileBin_ELF::GetAddrOffset(void) const
+{
+    return AddrOffset;
+}
+
+uint64_t FileBin_ELF::GetAddrLen(void) const
+{
+    return AddrLen;
+}
+
+uint64_t FileBin_ELF::GetTypesOffset(void) const
+{
+    return TypesOffset;
+}
+
+uint64_t FileBin_ELF::GetTypesLen(void) const
+{
+    return TypesLen;
+}
+
+uint64_t FileBin_ELF::GetCuIndexOffset(void) const
+{
+    return CuIndexOffset;
+}
+
+uint64_t FileBin_ELF::GetCuIndexLen(void) const
+{
+    return CuIndexLen;
+}
+
+uint64_t FileBin_ELF::GetTuIndexOffset(void) const
+{
+    return TuIndexOffset;
+}
+
+uint64_t FileBin_ELF::GetTuIndexLen(void) const
+{
+    return TuIndexLen;
+}
+
+const MappedFile& FileBin_ELF::GetFile(void) const
+{
+    return File;
+}
+
+std::vector<const Elf64_Shdr*> FileBin_ELF::GetSections(std::string_view name) const
+{
+    std::vector<const Elf64_Shdr*> sections;
+    for (uint32_t i = 0; i < SectionHeader.size(); i++)
+    {
+        if ((SectionHeader[i].sh_type == SHT_PROGBITS) && (SectionNameStr[i].Name == name))
+        {
+            sections.push_back(&SectionHeader[i]);
+        }
+    }
+
+    return sections;
+}
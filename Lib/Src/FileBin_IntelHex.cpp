@@ -34,6 +34,7 @@
 #include "QFile"
 #include <QDataStream>
 #include "Log.h"
+#include <cstring>
 
 
 FileBin_IntelHex_Page::FileBin_IntelHex_Page(void)
@@ -150,171 +151,125 @@ bool FileBin_IntelHex_Memory::GetMemPageOffset(uint32_t *pPage, uint32_t *pOffse
 
 }
 
-uint8_t FileBin_IntelHex_Memory::ReadMem_uint8(uint32_t Address)
+void FileBin_IntelHex_Memory::SetByteOrder(FileBin_ByteOrder Order)
 {
-    uint8_t fBuf[64];
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-        if (this->Page.at(Page).Byte.size() < (Offset + 1))
-        {
-            cout << "Error reading memory" << endl;
-            return 0.0f;
-        }
-
-        fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-
-        return (fBuf[0]);
-    }
+    this->ByteOrder = Order;
+}
 
-    return 0;
+FileBin_ByteOrder FileBin_IntelHex_Memory::GetByteOrder(void) const
+{
+    return this->ByteOrder;
 }
 
-int8_t FileBin_IntelHex_Memory::ReadMem_sint8(uint32_t Address)
+/* Multi-byte accesses follow the target byte order set by SetByteOrder() */
+template <typename T>
+T FileBin_IntelHex_Memory::ReadMem(uint32_t Address)
 {
-    uint8_t fBuf[64];
     uint32_t Page, Offset;
 
     if (GetMemPageOffset(&Page, &Offset, Address))
     {
-        if (this->Page.at(Page).Byte.size() < (Offset + 1))
+        if (this->Page.at(Page).Byte.size() < (Offset + sizeof(T)))
         {
             cout << "Error reading memory" << endl;
-            return 0.0f;
+            return 0;
         }
 
-        fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-
-        return (fBuf[0]);
+        return FileBin_Endian_Load<T>(&this->Page.at(Page).Byte.at(Offset), this->ByteOrder);
     }
 
     return 0;
 }
 
-uint16_t FileBin_IntelHex_Memory::ReadMem_uint16(uint32_t Address)
+template <typename T>
+bool FileBin_IntelHex_Memory::WriteMem(uint32_t Address, T value)
 {
-
-    uint8_t fBuf[64];
     uint32_t Page, Offset;
 
     if (GetMemPageOffset(&Page, &Offset, Address))
     {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 1 + 1))
+        if (this->Page.at(Page).Byte.size() < (Offset + sizeof(T)))
         {
-            cout << "Error reading memory" << endl;
-            return 0.0f;
+            cout << "Error writing memory" << endl;
+            return false;
         }
 
-        fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-        fBuf[1] = this->Page.at(Page).Byte.at(Offset+1);
-
-        return (fBuf[1] << 8u | fBuf[0]);
+        FileBin_Endian_Store<T>(&this->Page.at(Page).Byte.at(Offset), value, this->ByteOrder);
+        return true;
     }
 
-    return 0;
-
+    return false;
 }
 
-int16_t FileBin_IntelHex_Memory::ReadMem_sint16(uint32_t Address)
+uint8_t FileBin_IntelHex_Memory::ReadMem_uint8(uint32_t Address)
 {
     uint8_t fBuf[64];
     uint32_t Page, Offset;
 
     if (GetMemPageOffset(&Page, &Offset, Address))
     {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 1 + 1))
+        if (this->Page.at(Page).Byte.size() < (Offset + 1))
         {
             cout << "Error reading memory" << endl;
             return 0.0f;
         }
 
         fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-        fBuf[1] = this->Page.at(Page).Byte.at(Offset+1);
 
-        return (fBuf[1] << 8u | fBuf[0]);
+        return (fBuf[0]);
     }
 
     return 0;
 }
 
-uint32_t FileBin_IntelHex_Memory::ReadMem_uint32(uint32_t Address)
+int8_t FileBin_IntelHex_Memory::ReadMem_sint8(uint32_t Address)
 {
     uint8_t fBuf[64];
     uint32_t Page, Offset;
 
     if (GetMemPageOffset(&Page, &Offset, Address))
     {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 3 + 1))
+        if (this->Page.at(Page).Byte.size() < (Offset + 1))
         {
             cout << "Error reading memory" << endl;
             return 0.0f;
         }
 
         fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-        fBuf[1] = this->Page.at(Page).Byte.at(Offset+1);
-        fBuf[2] = this->Page.at(Page).Byte.at(Offset+2);
-        fBuf[3] = this->Page.at(Page).Byte.at(Offset+3);
 
-        return (fBuf[3] << 24u) | (fBuf[2] << 16u) | (fBuf[1] << 8u | fBuf[0]);
+        return (fBuf[0]);
     }
 
     return 0;
 }
 
-int32_t FileBin_IntelHex_Memory::ReadMem_sint32(uint32_t Address)
+uint16_t FileBin_IntelHex_Memory::ReadMem_uint16(uint32_t Address)
 {
-    uint8_t fBuf[64];
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 3 + 1))
-        {
-            cout << "Error reading memory" << endl;
-            return 0.0f;
-        }
+    return ReadMem<uint16_t>(Address);
+}
 
-        fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-        fBuf[1] = this->Page.at(Page).Byte.at(Offset+1);
-        fBuf[2] = this->Page.at(Page).Byte.at(Offset+2);
-        fBuf[3] = this->Page.at(Page).Byte.at(Offset+3);
+int16_t FileBin_IntelHex_Memory::ReadMem_sint16(uint32_t Address)
+{
+    return ReadMem<int16_t>(Address);
+}
 
-        return (fBuf[3] << 24u) | (fBuf[2] << 16u) | (fBuf[1] << 8u | fBuf[0]);
-    }
+uint32_t FileBin_IntelHex_Memory::ReadMem_uint32(uint32_t Address)
+{
+    return ReadMem<uint32_t>(Address);
+}
 
-    return 0;
+int32_t FileBin_IntelHex_Memory::ReadMem_sint32(uint32_t Address)
+{
+    return ReadMem<int32_t>(Address);
 }
 
 float FileBin_IntelHex_Memory::ReadMem_float32(uint32_t Address)
 {
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
+    uint32_t raw = ReadMem<uint32_t>(Address);
+    float val;
 
-        if (this->Page.at(Page).Byte.size() < (Offset + 3 + 1))
-        {
-            cout << "Error reading memory" << endl;
-            return 0.0f;
-        }
-
-        uint8_t fBuf[4];
-
-        fBuf[0] = this->Page.at(Page).Byte.at(Offset);
-        fBuf[1] = this->Page.at(Page).Byte.at(Offset+1);
-        fBuf[2] = this->Page.at(Page).Byte.at(Offset+2);
-        fBuf[3] = this->Page.at(Page).Byte.at(Offset+3);
-
-        float val = *(float *)&fBuf;
-        return val;
-    }
-
-    return 0.0f;
+    memcpy(&val, &raw, sizeof(val));
+    return val;
 }
 
 void FileBin_IntelHex_Memory::WriteMem_boolean(uint32_t Address, uint8_t value)
@@ -373,113 +328,33 @@ void FileBin_IntelHex_Memory::WriteMem_sint8(uint32_t Address, int8_t value)
 
 void FileBin_IntelHex_Memory::WriteMem_uint16(uint32_t Address, uint16_t value)
 {
-
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
+    if (WriteMem<uint16_t>(Address, value))
     {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 2))
-        {
-            cout << "Error writing memory" << endl;
-            return;
-        }
-
-        this->Page.at(Page).Byte.at(Offset) = value & 0xFF;
-        this->Page.at(Page).Byte.at(Offset+1) =(value >> 8u) & 0xFF;
-
         std::cout << "writing memory 0x" << std::hex << (int)Address << " value " << value << std::endl;
     }
-
 }
 
 void FileBin_IntelHex_Memory::WriteMem_sint16(uint32_t Address, int16_t value)
 {
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 2))
-        {
-            cout << "Error writing memory" << endl;
-            return;
-        }
-
-        this->Page.at(Page).Byte.at(Offset) = value & 0xFF;
-        this->Page.at(Page).Byte.at(Offset+1) =(value >> 8u) & 0xFF;
-    }
-
+    WriteMem<int16_t>(Address, value);
 }
 
 void FileBin_IntelHex_Memory::WriteMem_uint32(uint32_t Address, uint32_t value)
 {
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 4))
-        {
-            cout << "Error writing memory" << endl;
-            return;
-        }
-
-        this->Page.at(Page).Byte.at(Offset) = value & 0xFF;
-        this->Page.at(Page).Byte.at(Offset+1) =(value >> 8u) & 0xFF;;
-        this->Page.at(Page).Byte.at(Offset+2) =(value >> 16u) & 0xFF;;
-        this->Page.at(Page).Byte.at(Offset+3) =(value >> 24u) & 0xFF;;
-    }
-
+    WriteMem<uint32_t>(Address, value);
 }
 
 void FileBin_IntelHex_Memory::WriteMem_sint32(uint32_t Address, int32_t value)
 {
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 3 + 1))
-        {
-            cout << "Error writing memory" << endl;
-            return;
-        }
-
-        this->Page.at(Page).Byte.at(Offset) = value & 0xFF;
-        this->Page.at(Page).Byte.at(Offset+1) =(value >> 8u) & 0xFF;;
-        this->Page.at(Page).Byte.at(Offset+2) =(value >> 16u) & 0xFF;;
-        this->Page.at(Page).Byte.at(Offset+3) =(value >> 24u) & 0xFF;;
-    }
-
+    WriteMem<int32_t>(Address, value);
 }
 
 void FileBin_IntelHex_Memory::WriteMem_float32(uint32_t Address, float value)
 {
-    uint32_t Page, Offset;
-
-    if (GetMemPageOffset(&Page, &Offset, Address))
-    {
-
-        if (this->Page.at(Page).Byte.size() < (Offset + 3 + 1))
-        {
-            cout << "Error writing memory" << endl;
-            return;
-        }
-
-        union {
-            float a;
-            unsigned char bytes[4];
-          } thing;
-
-        thing.a = value;
-
-         this->Page.at(Page).Byte.at(Offset) = thing.bytes[0];
-         this->Page.at(Page).Byte.at(Offset+1) = thing.bytes[1];
-         this->Page.at(Page).Byte.at(Offset+2) = thing.bytes[2];
-         this->Page.at(Page).Byte.at(Offset+3) = thing.bytes[3];
-    }
+    uint32_t raw;
 
+    memcpy(&raw, &value, sizeof(raw));
+    WriteMem<uint32_t>(Address, raw);
 }
 
 bool FileBin_IntelHex_Memory::Save(string filename)
@@ -0,0 +1,151 @@
+/**
+ *  \file       FileBin_MappedFile.cpp
+ *  \brief      Read-only memory mapped file
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+#include "FileBin_MappedFile.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::open(const std::string& fileName)
+{
+    /* Re-opening drops any previous mapping */
+    close();
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    hFile = file;
+
+    LARGE_INTEGER fsize;
+    if ((!GetFileSizeEx(file, &fsize)) || (fsize.QuadPart == 0))
+    {
+        close();
+        return false;
+    }
+
+    hMap = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!hMap)
+    {
+        close();
+        return false;
+    }
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(static_cast<HANDLE>(hMap), FILE_MAP_READ, 0, 0, 0));
+    if (!data)
+    {
+        close();
+        return false;
+    }
+
+    size = static_cast<size_t>(fsize.QuadPart);
+#else
+    fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if ((fstat(fd, &st) < 0) || (st.st_size <= 0))
+    {
+        close();
+        return false;
+    }
+
+    void* map = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        close();
+        return false;
+    }
+
+    data = static_cast<const uint8_t*>(map);
+    size = static_cast<size_t>(st.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+    if (hMap)
+    {
+        CloseHandle(static_cast<HANDLE>(hMap));
+    }
+    if (hFile)
+    {
+        CloseHandle(static_cast<HANDLE>(hFile));
+    }
+    hMap = nullptr;
+    hFile = nullptr;
+#else
+    if (data)
+    {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+    if (fd >= 0)
+    {
+        ::close(fd);
+    }
+    fd = -1;
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool MappedFile::isOpen(void) const
+{
+    return (data != nullptr);
+}
+
+const uint8_t* MappedFile::at(uint64_t offset, uint64_t len) const
+{
+    if ((!data) || (offset > size) || (len > (size - offset)))
+    {
+        return nullptr;
+    }
+
+    return data + offset;
+}
@@ -0,0 +1,149 @@
+/**
+ *  \file       FileBin_Search.cpp
+ *  \brief      Trigram substring index over names
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#include "FileBin_Search.h"
+#include <algorithm>
+#include <string>
+
+static inline uint8_t FileBin_Search_Lower(uint8_t c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? static_cast<uint8_t>(c + ('a' - 'A')) : c;
+}
+
+static inline uint32_t FileBin_Search_Trigram(const char* p)
+{
+    return (static_cast<uint32_t>(FileBin_Search_Lower(p[0])) << 16) |
+           (static_cast<uint32_t>(FileBin_Search_Lower(p[1])) << 8) |
+           static_cast<uint32_t>(FileBin_Search_Lower(p[2]));
+}
+
+void FileBin_SearchIndex::Add(std::string_view text, const void* item)
+{
+    uint32_t id = static_cast<uint32_t>(this->Text.size());
+
+    this->Text.push_back(text);
+    this->Item.push_back(item);
+
+    for (size_t i = 0; i + 3 <= text.size(); i++)
+    {
+        std::vector<uint32_t>& list = this->Posting[FileBin_Search_Trigram(text.data() + i)];
+
+        // A trigram repeated within the same entry is listed once
+        if (list.empty() || (list.back() != id))
+        {
+            list.push_back(id);
+        }
+    }
+}
+
+void FileBin_SearchIndex::Clear(void)
+{
+    this->Text.clear();
+    this->Item.clear();
+    this->Posting.clear();
+}
+
+uint32_t FileBin_SearchIndex::Size(void) const
+{
+    return static_cast<uint32_t>(this->Text.size());
+}
+
+bool FileBin_SearchIndex::Contains(std::string_view text, std::string_view lowerQuery)
+{
+    auto it = std::search(text.begin(), text.end(), lowerQuery.begin(), lowerQuery.end(),
+                          [](char a, char b) { return FileBin_Search_Lower(static_cast<uint8_t>(a)) == static_cast<uint8_t>(b); });
+
+    return it != text.end();
+}
+
+std::vector<const void*> FileBin_SearchIndex::Find(std::string_view query, uint32_t maxResults) const
+{
+    std::vector<const void*> result;
+
+    if (query.empty() || (maxResults == 0))
+    {
+        return result;
+    }
+
+    std::string lowerQuery(query);
+    for (char& c : lowerQuery)
+    {
+        c = static_cast<char>(FileBin_Search_Lower(static_cast<uint8_t>(c)));
+    }
+
+    /* Too short for a trigram, every entry is a candidate */
+    if (lowerQuery.size() < 3)
+    {
+        for (uint32_t id = 0; (id < this->Text.size()) && (result.size() < maxResults); id++)
+        {
+            if (Contains(this->Text[id], lowerQuery))
+            {
+                result.push_back(this->Item[id]);
+            }
+        }
+
+        return result;
+    }
+
+    /* Any match holds every trigram of the query, the rarest one gives the fewest candidates */
+    const std::vector<uint32_t>* candidates = nullptr;
+    for (size_t i = 0; i + 3 <= lowerQuery.size(); i++)
+    {
+        auto it = this->Posting.find(FileBin_Search_Trigram(lowerQuery.data() + i));
+        if (it == this->Posting.end())
+        {
+            return result;
+        }
+
+        if (!candidates || (it->second.size() < candidates->size()))
+        {
+            candidates = &it->second;
+        }
+    }
+
+    for (uint32_t id : *candidates)
+    {
+        if (Contains(this->Text[id], lowerQuery))
+        {
+            result.push_back(this->Item[id]);
+
+            if (result.size() >= maxResults)
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
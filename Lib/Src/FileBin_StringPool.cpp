@@ -0,0 +1,220 @@
+/**
+ *  \file       FileBin_StringPool.cpp
+ *  \brief      Interned names with 32-bit ids
+ *
+ *  \version    1.0
+ *  \date       Oct 16, 2026
+ *  \author     Xavier Descarrega - DEVE embedded designs <info@deve.tech>
+ *
+ *  \copyright  MIT License
+ *
+ *              Copyright (c) 2016 Xavier Descarrega
+ *
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ *
+ */
+
+
+
+#include "FileBin_StringPool.h"
+#include <cstring>
+
+/* Id layout: index within the shard above the shard number */
+static inline uint32_t FileBin_StringPool_ShardOf(std::string_view text)
+{
+    return static_cast<uint32_t>(std::hash<std::string_view>()(text)) & (FILEBIN_STRINGPOOL_SHARD_CNT - 1);
+}
+
+FileBin_StringPool::FileBin_StringPool(void)
+{
+    Clear();
+}
+
+uint32_t FileBin_StringPool::Intern(std::string_view text)
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    uint32_t shardIdx = FileBin_StringPool_ShardOf(text);
+    ShardType& shard = this->Shard[shardIdx];
+    std::lock_guard<std::mutex> lock(shard.Lock);
+    Index(shardIdx);
+
+    auto it = shard.Ids.find(text);
+    if (it != shard.Ids.end())
+    {
+        return it->second;
+    }
+
+    uint32_t id = (static_cast<uint32_t>(shard.Names.size()) << FILEBIN_STRINGPOOL_SHARD_BITS) | shardIdx;
+    shard.Names.push_back(text);
+    shard.Ids.emplace(text, id);
+    shard.IndexedCnt++;
+
+    return id;
+}
+
+bool FileBin_StringPool::Restore(uint32_t id, std::string_view text)
+{
+    ShardType& shard = this->Shard[id & (FILEBIN_STRINGPOOL_SHARD_CNT - 1)];
+    uint32_t idx = id >> FILEBIN_STRINGPOOL_SHARD_BITS;
+
+    // Names interned before (fixed labels) are already in place
+    if (idx < shard.Names.size())
+    {
+        return !text.empty() && (shard.Names[idx] == text);
+    }
+
+    if (text.empty() || (idx != shard.Names.size()))
+    {
+        return false;
+    }
+
+    shard.Names.push_back(text);
+    return true;
+}
+
+void FileBin_StringPool::Index(uint32_t shardIdx) const
+{
+    const ShardType& shard = this->Shard[shardIdx];
+
+    for (; shard.IndexedCnt < shard.Names.size(); shard.IndexedCnt++)
+    {
+        if (!shard.Names[shard.IndexedCnt].empty())
+        {
+            shard.Ids.emplace(shard.Names[shard.IndexedCnt], (shard.IndexedCnt << FILEBIN_STRINGPOOL_SHARD_BITS) | shardIdx);
+        }
+    }
+}
+
+uint32_t FileBin_StringPool::Find(std::string_view text) const
+{
+    if (text.empty())
+    {
+        return 0;
+    }
+
+    uint32_t shardIdx = FileBin_StringPool_ShardOf(text);
+    const ShardType& shard = this->Shard[shardIdx];
+    std::lock_guard<std::mutex> lock(shard.Lock);
+    Index(shardIdx);
+
+    auto it = shard.Ids.find(text);
+
+    return (it != shard.Ids.end()) ? it->second : 0;
+}
+
+std::string_view FileBin_StringPool::Get(uint32_t id) const
+{
+    const ShardType& shard = this->Shard[id & (FILEBIN_STRINGPOOL_SHARD_CNT - 1)];
+    uint32_t idx = id >> FILEBIN_STRINGPOOL_SHARD_BITS;
+
+    return (idx < shard.Names.size()) ? shard.Names[idx] : std::string_view();
+}
+
+uint32_t FileBin_StringPool::Size(void) const
+{
+    uint32_t size = 0;
+
+    for (const ShardType& shard : this->Shard)
+    {
+        size += static_cast<uint32_t>(shard.Names.size());
+    }
+
+    return size - 1;
+}
+
+void FileBin_StringPool::Clear(void)
+{
+    for (ShardType& shard : this->Shard)
+    {
+        shard.Ids.clear();
+        shard.IndexedCnt = 0;
+        shard.Names.clear();
+        shard.Storage.clear();
+        shard.OwnedCnt = 0;
+    }
+
+    // Slot 0 of shard 0 is id 0, the empty name
+    this->Shard[0].Names.push_back(std::string_view());
+}
+
+void FileBin_StringPool::ForEach(const std::function<void(uint32_t, std::string_view)>& fn) const
+{
+    for (uint32_t shardIdx = 0; shardIdx < FILEBIN_STRINGPOOL_SHARD_CNT; shardIdx++)
+    {
+        const ShardType& shard = this->Shard[shardIdx];
+
+        // Id 0 (the empty name) is not a pool entry
+        for (uint32_t idx = (shardIdx == 0) ? 1 : 0; idx < shard.Names.size(); idx++)
+        {
+            fn((idx << FILEBIN_STRINGPOOL_SHARD_BITS) | shardIdx, shard.Names[idx]);
+        }
+    }
+}
+
+void FileBin_StringPool::Own(void)
+{
+    for (uint32_t shardIdx = 0; shardIdx < FILEBIN_STRINGPOOL_SHARD_CNT; shardIdx++)
+    {
+        ShardType& shard = this->Shard[shardIdx];
+        Index(shardIdx);
+
+        uint32_t nameCnt = static_cast<uint32_t>(shard.Names.size());
+        size_t bytes = 0;
+
+        for (uint32_t idx = shard.OwnedCnt; idx < nameCnt; idx++)
+        {
+            bytes += shard.Names[idx].size();
+        }
+
+        if (bytes == 0)
+        {
+            shard.OwnedCnt = nameCnt;
+            continue;
+        }
+
+        // One block per call, earlier blocks stay since views into them may still be held
+        std::unique_ptr<char[]> block(new char[bytes]);
+        char* dst = block.get();
+
+        for (uint32_t idx = shard.OwnedCnt; idx < nameCnt; idx++)
+        {
+            std::string_view& name = shard.Names[idx];
+            if (name.empty())
+            {
+                continue;
+            }
+
+            auto it = shard.Ids.find(name);
+            uint32_t id = it->second;
+            shard.Ids.erase(it);
+
+            std::memcpy(dst, name.data(), name.size());
+            name = std::string_view(dst, name.size());
+            shard.Ids.emplace(name, id);
+            dst += name.size();
+        }
+
+        shard.Storage.push_back(std::move(block));
+        shard.OwnedCnt = nameCnt;
+    }
+}
@@ -706,8 +706,8 @@ bool IsViewAdvanced;
 QTreeWidget  *m_treeWidget;   // Left: Hierarchy/Symbols
 QTreeWidget *m_symbolTree;
 
-BinCalibToolWidget::BinCalibToolWidget(QWidget* parent, FileBin_ELF* elf)
-    : QWidget(parent), ELFData(elf)
+BinCalibToolWidget::BinCalibToolWidget(QWidget* parent, FileBin_ELF* elf, FileBin_DWARF* dwarf)
+    : QWidget(parent), ELFData(elf), DWARFData(dwarf)
 {
     IsViewAdvanced = true;
     BaseFileData.clear();
@@ -1068,49 +1068,49 @@ DataValue BinCalibToolWidget::readMem(uint32_t BaseFileIdx, uint32_t Addr, FileB
             case FileBin_VARINFO_TYPE_UINT8:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint8(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint8(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_SINT8:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint8(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint8(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_UINT16:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint16(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint16(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_SINT16:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint16(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint16(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_UINT32:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint32(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_uint32(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_SINT32:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint32(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_sint32(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_FLOAT32:
             {
                 WidgetTreeTextBox *lineedit = (WidgetTreeTextBox *)baseData.at(i)->WidgetData;
-                lineedit->SetVal(QString::number(newFileBin->ReadMem_float32(baseData.at(i)->node->Addr)));
+                lineedit->SetVal(QString::number(newFileBin->ReadMem_float32(baseData.at(i)->Addr)));
                 break;
             }
             case FileBin_VARINFO_TYPE_ENUM:
             {
                 WidgetTreeComboBox *dataWidget = (WidgetTreeComboBox *)baseData.at(i)->WidgetData;
-                dataWidget->setIdx(newFileBin->ReadMem_uint8(baseData.at(i)->node->Addr));
+                dataWidget->setIdx(newFileBin->ReadMem_uint8(baseData.at(i)->Addr));
                 break;
             }
             default:
@@ -1140,6 +1140,16 @@ DataValue BinCalibToolWidget::readMem(uint32_t BaseFileIdx, uint32_t Addr, FileB
         return;
     }
 
+    /* Absolute address of the symbol, type layout nodes only carry an offset */
+    uint64_t addr = this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->Addr;
+
+    /* Intel HEX addresses 32 bits, a symbol above cannot be in the base file */
+    if (addr > UINT32_MAX)
+    {
+        cout << "Address out of the base file range: 0x" << std::hex << addr << std::dec << endl;
+        return;
+    }
+
     //cout << "Writing memory BinFile type: " << (int)InfoNode->DataType <<  " Idx: " << BinIdx << " Symbol Idx: " << SymbolIdx << " Addr: 0x" << std::hex << InfoNode->Addr <<  endl;
 
     switch(this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->node->DataType)
@@ -1147,56 +1157,56 @@ DataValue BinCalibToolWidget::readMem(uint32_t BaseFileIdx, uint32_t Addr, FileB
         case FileBin_VARINFO_TYPE_BOOLEAN:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_boolean(InfoNode->Addr, textBox->text().toFloat());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_boolean(addr, textBox->text().toFloat());
             break;
         }
 
         case FileBin_VARINFO_TYPE_UINT8:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint8(InfoNode->Addr, textBox->text().toUInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint8(addr, textBox->text().toUInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_SINT8:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint8(InfoNode->Addr, textBox->text().toInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint8(addr, textBox->text().toInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_UINT16:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint16(InfoNode->Addr, textBox->text().toUInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint16(addr, textBox->text().toUInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_SINT16:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint16(InfoNode->Addr, textBox->text().toInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint16(addr, textBox->text().toInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_UINT32:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint32(InfoNode->Addr, textBox->text().toUInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint32(addr, textBox->text().toUInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_SINT32:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint32(InfoNode->Addr, textBox->text().toInt());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_sint32(addr, textBox->text().toInt());
             break;
         }
 
         case FileBin_VARINFO_TYPE_FLOAT32:
         {
             WidgetTreeTextBox* textBox = (WidgetTreeTextBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_float32(InfoNode->Addr, textBox->text().toFloat());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_float32(addr, textBox->text().toFloat());
             break;
         }
 
@@ -1204,7 +1214,7 @@ DataValue BinCalibToolWidget::readMem(uint32_t BaseFileIdx, uint32_t Addr, FileB
         {
 
             WidgetTreeComboBox* comboBox = (WidgetTreeComboBox*)this->BaseFileData.at(BinIdx)->data.at(SymbolIdx)->WidgetData;
-            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint8(InfoNode->Addr, comboBox->currentIndex());
+            this->BaseFileData.at(BinIdx)->mem->WriteMem_uint8(addr, comboBox->currentIndex());
             break;
         }
 
@@ -1215,8 +1225,15 @@ DataValue BinCalibToolWidget::readMem(uint32_t BaseFileIdx, uint32_t Addr, FileB
     }
 }
 
-void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType* node)
+void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType* node, uint64_t addr)
 {
+    /* Intel HEX addresses 32 bits, a symbol above cannot be in the base file */
+    if (addr > UINT32_MAX)
+    {
+        cout << "Address out of the base file range: 0x" << std::hex << addr << std::dec << endl;
+        return;
+    }
+
     uint32_t xLen = node->Size.at(0);
     uint32_t yLen = 1;
     uint8_t dataSize = node->Size.back();
@@ -1264,15 +1281,15 @@ void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType*
         }
         case FileBin_VARINFO_TYPE_UINT16:
         {
-            vector<uint8_t> defaultDataRaw = this->ELFData->readSymbolFromELF(node->Addr, xLen * yLen * 2);
+            const uint8_t* defaultDataRaw = this->ELFData->readSymbolView(addr, xLen * yLen * 2);
 
             // Convert every two bytes into uint16_t
             for (size_t i = 0; i < xLen * yLen; i += 1)
             {
-                uint16_t value  = this->BaseFileData.at(BaseFileIdx)->mem->ReadMem_uint16(node->Addr + i*2);
+                uint16_t value  = this->BaseFileData.at(BaseFileIdx)->mem->ReadMem_uint16(addr + i*2);
                 data.push_back(value);
 
-                value = defaultDataRaw.at(i*2) + (defaultDataRaw.at((i*2)+1) << 8);
+                value = defaultDataRaw ? FileBin_Endian_Load<uint16_t>(defaultDataRaw + i*2, this->ELFData->GetByteOrder()) : 0;
                 defaultData.push_back(value);
             }
 
@@ -1280,15 +1297,15 @@ void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType*
         }
         case FileBin_VARINFO_TYPE_SINT16:
         {
-            vector<uint8_t> defaultDataRaw = this->ELFData->readSymbolFromELF(node->Addr, xLen * yLen * 2);
+            const uint8_t* defaultDataRaw = this->ELFData->readSymbolView(addr, xLen * yLen * 2);
 
             // Convert every two bytes into uint16_t
             for (size_t i = 0; i < xLen * yLen; i += 1)
             {
-                uint16_t value  = this->BaseFileData.at(BaseFileIdx)->mem->ReadMem_sint16(node->Addr + i*2);
+                uint16_t value  = this->BaseFileData.at(BaseFileIdx)->mem->ReadMem_sint16(addr + i*2);
                 data.push_back(value);
 
-                value = defaultDataRaw.at(i*2) + (defaultDataRaw.at((i*2)+1) << 8);
+                value = defaultDataRaw ? FileBin_Endian_Load<uint16_t>(defaultDataRaw + i*2, this->ELFData->GetByteOrder()) : 0;
                 defaultData.push_back(value);
             }
 
@@ -1355,13 +1372,13 @@ void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType*
     disconnect(m_tableWidgetCalib, &QTableWidget::itemChanged, nullptr, nullptr);
 
     connect(m_tableWidgetCalib, &QTableWidget::itemChanged,
-            this, [this, BaseFileIdx, node, dataSize, xLen](QTableWidgetItem *item){
+            this, [this, BaseFileIdx, addr, dataSize, xLen](QTableWidgetItem *item){
                 int row = item->row();
                 int col = item->column();
                 size_t offset = (row * xLen + col) * dataSize;
                 uint16_t value = item->text().toUInt();
                 this->BaseFileData.at(BaseFileIdx)->mem->WriteMem_uint16(
-                    node->Addr + offset,
+                    addr + offset,
                     value
                     );
 
@@ -1375,7 +1392,74 @@ void BinCalibToolWidget::GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType*
 
 }
 
-void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node, QTreeWidgetItem* item, uint32_t BaseFileIdx)
+/* Default value byte length of a scalar symbol, 0 if it is not shown as a single value */
+static uint32_t Calib_DefaultValueLen(FileBin_VarInfoType* node)
+{
+    switch (node->DataType)
+    {
+        case FileBin_VARINFO_TYPE_BOOLEAN:
+        case FileBin_VARINFO_TYPE_UINT8:
+        case FileBin_VARINFO_TYPE_SINT8:   return 1;
+        case FileBin_VARINFO_TYPE_UINT16:
+        case FileBin_VARINFO_TYPE_SINT16:  return 2;
+        case FileBin_VARINFO_TYPE_UINT32:
+        case FileBin_VARINFO_TYPE_SINT32:
+        case FileBin_VARINFO_TYPE_FLOAT32: return 4;
+        case FileBin_VARINFO_TYPE_ENUM:    return (node->Size.size() > 0) ? node->Size.at(0) : 0;
+        default:                           return 0;
+    }
+}
+
+void BinCalibToolWidget::Calib_DefaultValueCollect(FileBin_VarInfoType* node, uint64_t baseAddr, std::vector<SymbolReadRequest>& requests)
+{
+    while (node)
+    {
+        uint64_t addr = baseAddr + node->Addr;
+
+        if (!node->isQualifier && (node->Size.size() <= 1))
+        {
+            uint32_t len = Calib_DefaultValueLen(node);
+
+            if (len > 0)
+            {
+                requests.push_back({addr, len, nullptr});
+            }
+        }
+
+        if (node->child)
+        {
+            this->Calib_DefaultValueCollect(node->child, addr, requests);
+        }
+
+        node = node->next;
+    }
+}
+
+void BinCalibToolWidget::Calib_DefaultValuePrefetch(FileBin_VarInfoType* node)
+{
+    std::vector<SymbolReadRequest> requests;
+
+    this->DefaultValue.clear();
+    this->Calib_DefaultValueCollect(node, 0, requests);
+
+    /* Resolve all default values of the selected unit in a single pass over the ELF */
+    this->ELFData->readSymbolsFromELF(requests);
+
+    this->DefaultValue.reserve(requests.size());
+    for (uint32_t i = 0; i < requests.size(); i++)
+    {
+        this->DefaultValue[requests[i].va] = requests[i].data;
+    }
+}
+
+const uint8_t* BinCalibToolWidget::Calib_DefaultValueGet(uint64_t addr) const
+{
+    auto it = this->DefaultValue.find(addr);
+
+    return (it != this->DefaultValue.end()) ? it->second : nullptr;
+}
+
+void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node, QTreeWidgetItem* item, uint32_t BaseFileIdx, uint64_t baseAddr)
 {
 
     uint32_t childIdx = 0;
@@ -1383,6 +1467,8 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
     while (node)
     {
+        uint64_t addr = baseAddr + node->Addr;
+
         // Skip qualifier nodes for the row but still recurse into children
         if (!node->isQualifier)
         {
@@ -1398,10 +1484,10 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
                     dims << QString::number(node->Size[i]);
                 }
 
-                QObject::connect(widgetData, &WidgetTreeTextBox::clickedOrFocused, [this, node, BaseFileIdx]() {
+                QObject::connect(widgetData, &WidgetTreeTextBox::clickedOrFocused, [this, node, addr, BaseFileIdx]() {
                     tableContainer->setVisible(true);        // show table + toolbar
                     rightSplitter->setSizes({300, 200});     // optional: restore splitter sizes
-                    this->GenerateTable(BaseFileIdx, node);
+                    this->GenerateTable(BaseFileIdx, node, addr);
                 });
 
                 widgetData->setText("<" + dims.join(" x ") + ">");
@@ -1412,11 +1498,11 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
             {
                 if (FileBin_VARINFO_TYPE_BOOLEAN == node->DataType)
                 {
-                    std::vector<uint8_t> raw = this->ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     bool value = 0;
 
-                    if (raw.size() >= 1)
+                    if (raw)
                     {
                         value = static_cast<uint8_t>(raw[0]);
                     }
@@ -1431,15 +1517,16 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_UINT8 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = this->ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     uint8_t value = 0;
-                    if (raw.size() >= 1)
+                    if (raw)
                     {
                         value = static_cast<uint8_t>(raw[0]);
                     }
@@ -1454,15 +1541,16 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_SINT8 == node->DataType)
                 {
-                     std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     int8_t value = 0;
-                    if (raw.size() >= 1)
+                    if (raw)
                     {
                         value = static_cast<int8_t>(raw[0]);
                     }
@@ -1477,18 +1565,18 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_UINT16 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     uint16_t value = 0;
-                    if (raw.size() >= 2)
+                    if (raw)
                     {
-                        value = static_cast<uint16_t>(raw[0])
-                        | (static_cast<uint16_t>(raw[1]) << 8);
+                        value = FileBin_Endian_Load<uint16_t>(raw, this->ELFData->GetByteOrder());
                     }
 
                     WidgetTreeTextBox *widgetData = new WidgetTreeTextBox(this, false, 0, BaseFileIdx, BaseFileData.at(BaseFileIdx)->data.size(), value);
@@ -1501,18 +1589,18 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_SINT16 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     int16_t value = 0;
-                    if (raw.size() >= 2)
+                    if (raw)
                     {
-                        value = static_cast<int16_t>(raw[0])
-                        | (static_cast<int16_t>(raw[1]) << 8);
+                        value = FileBin_Endian_Load<int16_t>(raw, this->ELFData->GetByteOrder());
                     }
 
                     WidgetTreeTextBox *widgetData = new WidgetTreeTextBox(this, false, 0, BaseFileIdx, BaseFileData.at(BaseFileIdx)->data.size(), value);
@@ -1525,21 +1613,19 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_UINT32 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     uint32_t value = 0;
 
-                    if (raw.size() >= 4)
+                    if (raw)
                     {
-                        value = static_cast<uint32_t>(raw[0])
-                            | (static_cast<uint32_t>(raw[1]) << 8)
-                            | (static_cast<uint32_t>(raw[2]) << 16)
-                            | (static_cast<uint32_t>(raw[3]) << 24);
+                        value = FileBin_Endian_Load<uint32_t>(raw, this->ELFData->GetByteOrder());
                     }
 
                     WidgetTreeTextBox *widgetData = new WidgetTreeTextBox(this, false, 0, BaseFileIdx, BaseFileData.at(BaseFileIdx)->data.size(), value);
@@ -1552,21 +1638,19 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_SINT32 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     int32_t value = 0;
 
-                    if (raw.size() >= 4)
+                    if (raw)
                     {
-                        value = static_cast<int32_t>(raw[0])
-                            | (static_cast<int32_t>(raw[1]) << 8)
-                            | (static_cast<int32_t>(raw[2]) << 16)
-                            | (static_cast<int32_t>(raw[3]) << 24);
+                        value = FileBin_Endian_Load<int32_t>(raw, this->ELFData->GetByteOrder());
                     }
 
                     WidgetTreeTextBox *widgetData = new WidgetTreeTextBox(this, false, 0, BaseFileIdx, BaseFileData.at(BaseFileIdx)->data.size(), value);
@@ -1582,22 +1666,19 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_FLOAT32 == node->DataType)
                 {
-                    std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
+                    const uint8_t* raw = this->Calib_DefaultValueGet(addr);
 
                     float value = 0.0f;
 
-                    if (raw.size() >= 4)
+                    if (raw)
                     {
-                        uint32_t tmp =
-                            static_cast<uint32_t>(raw[0]) |
-                            (static_cast<uint32_t>(raw[1]) << 8) |
-                            (static_cast<uint32_t>(raw[2]) << 16) |
-                            (static_cast<uint32_t>(raw[3]) << 24);
+                        uint32_t tmp = FileBin_Endian_Load<uint32_t>(raw, this->ELFData->GetByteOrder());
 
                         std::memcpy(&value, &tmp, sizeof(float));
                     }
@@ -1613,17 +1694,27 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
                 else if (FileBin_VARINFO_TYPE_ENUM == node->DataType)
                 {
-                    uint8_t val;
+                    uint8_t val = 0;
 
                     if (node->Size.size() > 0)
                     {
-                        std::vector<uint8_t> raw = ELFData->readSymbolFromELF(node->Addr, node->Size.at(0));
-                        val = raw.at(0);
+                        const uint8_t* raw = this->Calib_DefaultValueGet(addr);
+                        if (raw)
+                        {
+                            // Enumerators are small, the value sits in the least significant byte
+                            switch (node->Size.at(0))
+                            {
+                                case 2:  val = static_cast<uint8_t>(FileBin_Endian_Load<uint16_t>(raw, this->ELFData->GetByteOrder())); break;
+                                case 4:  val = static_cast<uint8_t>(FileBin_Endian_Load<uint32_t>(raw, this->ELFData->GetByteOrder())); break;
+                                default: val = raw[0]; break;
+                            }
+                        }
                     }
 
                     WidgetTreeComboBox *widgetData = new WidgetTreeComboBox(this, BaseFileIdx, BaseFileData.at(BaseFileIdx)->data.size(), val);
@@ -1632,7 +1723,8 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     while (enumNode)
                     {
-                        widgetData->addItem(QString::fromStdString(std::string(enumNode->data.begin(), enumNode->data.end())));
+                        std::string_view enumName = this->DWARFData->GetName(enumNode->nameId);
+                        widgetData->addItem(QString::fromUtf8(enumName.data(), static_cast<int>(enumName.size())));
                         enumNode = enumNode->next;
                     }
 
@@ -1644,6 +1736,7 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
                     SymbolDataType *newDataInfo = new SymbolDataType();
                     newDataInfo->node = node;
+                    newDataInfo->Addr = addr;
                     newDataInfo->WidgetData = widgetData;
                     BaseFileData.at(BaseFileIdx)->data.push_back(newDataInfo);
                 }
@@ -1658,12 +1751,12 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
 
             if (node->child)
             {
-                this->Calib_BaseFile_WidgetPopulate(node->child, item->child(childIdx), BaseFileIdx);
+                this->Calib_BaseFile_WidgetPopulate(node->child, item->child(childIdx), BaseFileIdx, addr);
             }
         }
         else if (node->child)
         {
-            this->Calib_BaseFile_WidgetPopulate(node->child, item, BaseFileIdx);
+            this->Calib_BaseFile_WidgetPopulate(node->child, item, BaseFileIdx, addr);
         }
 
         node = node->next;
@@ -1671,7 +1764,7 @@ void BinCalibToolWidget::Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node
     }
 }
 
-static QString formatSize(const std::vector<uint32_t>& size)
+static QString formatSize(const FileBin_DWARF_SizeType& size)
 {
     if (size.empty())
         return {};
@@ -1687,14 +1780,12 @@ static QString formatSize(const std::vector<uint32_t>& size)
     return QString("<%1>").arg(dims.join(" x "));
 }
 
-static QString extractDisplayName(const FileBin_DWARF_VarInfoType* node)
+static QString extractDisplayName(const FileBin_DWARF_VarInfoType* node, std::string_view nodeName)
 {
-    if (node->data.empty())
+    if (nodeName.empty())
         return QStringLiteral("unnamed");
 
-    QString name = QString::fromStdString(
-        std::string(node->data.begin(), node->data.end())
-        );
+    QString name = QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size()));
 
     if (node->elementType == FILEBIN_DWARF_ELEMENT_COMPILE_UNIT)
     {
@@ -1725,16 +1816,19 @@ static QString formatType(uint32_t typeId)
     }
 }
 
-void BinCalibToolWidget::populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType* node, QTreeWidgetItem* parentItem)
+void BinCalibToolWidget::populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType* node, QTreeWidgetItem* parentItem, uint64_t baseAddr)
 {
     while (node)
     {
+        uint64_t absAddr = baseAddr + node->Addr;
+
         // Skip qualifier nodes for the row but still recurse into children
         if (!node->isQualifier)
         {
             // --- Prepare column texts ---
-            QString name = extractDisplayName(node); // your function
-            QString addr = QStringLiteral("0x") + QString::number(node->Addr, 16).toUpper();
+            std::string_view nodeName = this->DWARFData->GetName(node->nameId);
+            QString name = extractDisplayName(node, nodeName); // your function
+            QString addr = QStringLiteral("0x") + QString::number(absAddr, 16).toUpper();
             QString size = formatSize(node->Size);   // your function
             QString type = formatType(node->DataType);   // your function
 
@@ -1748,7 +1842,7 @@ void BinCalibToolWidget::populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType*
             item->setText(3, type);
             item->setTextAlignment(3, Qt::AlignCenter);
 
-            if (node->data.empty())
+            if (nodeName.empty())
             {
                 QFont f = item->font(0);
                 f.setItalic(true);
@@ -1775,13 +1869,13 @@ void BinCalibToolWidget::populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType*
             // --- Recurse into children ---
             if (node->child)
             {
-                populateTreeWidgetRecursive(node->child, item);
+                populateTreeWidgetRecursive(node->child, item, absAddr);
             }
         }
         else if (node->child)
         {
             // Qualifier node: skip row but recurse into children
-            populateTreeWidgetRecursive(node->child, parentItem);
+            populateTreeWidgetRecursive(node->child, parentItem, absAddr);
         }
 
         node = node->next; // move to sibling
@@ -1803,22 +1897,31 @@ void BinCalibToolWidget::onTreeItemClicked(QTreeWidgetItem* item, int column)
 
     m_symbolTree->clear();
 
+    /* Variables of the unit, decoded now if the DWARF was parsed lazily */
+    FileBin_DWARF_VarInfoType* unitSymbols = this->DWARFData ? this->DWARFData->GetUnitSymbols(node) : node->child;
+
     // Recursively populate children under invisible root
-    populateTreeWidgetRecursive(node->child, m_symbolTree->invisibleRootItem());
+    populateTreeWidgetRecursive(unitSymbols, m_symbolTree->invisibleRootItem());
 
     /* Set selected Compilation Unit */
-    this->selectedSymbolData = node->child;
+    this->selectedSymbolData = unitSymbols;
+    std::string_view unitPath = node ? this->DWARFData->GetName(node->nameId) : std::string_view();
+    this->selectedUnitPath = QString::fromUtf8(unitPath.data(), static_cast<int>(unitPath.size()));
+    this->Calib_DefaultValuePrefetch(unitSymbols);
 
     for (uint32_t i = 0 ; i < this->BaseFileData.size(); i++)
     {
         this->BaseFileData.at(i)->data.clear();
-        this->Calib_BaseFile_WidgetPopulate(node->child, m_symbolTree->invisibleRootItem(), i);
+        this->Calib_BaseFile_WidgetPopulate(unitSymbols, m_symbolTree->invisibleRootItem(), i);
         this->Calib_BaseFile_DataParse(nullptr, i, this->BaseFileData.at(i)->mem);
     }
 }
 
 void BinCalibToolWidget::Calib_BaseFile_AddNew(std::string filename, FileBin_IntelHex_Memory *newFileBin)
 {
+    /* Base file values use the byte order of the target described by the ELF */
+    newFileBin->SetByteOrder(this->ELFData->GetByteOrder());
+
     SymbolDataInfo *basefile = new SymbolDataInfo();
     basefile->filename = filename;
     basefile->mem = newFileBin;
@@ -1843,6 +1946,7 @@ void BinCalibToolWidget::Calib_MasterStruct(FileBin_VarInfoType* node)
 {
     m_treeWidget->clear();
     selectedSymbolData = nullptr;
+    DefaultValue.clear();
     SymbolData = node;
 
     QFont italicFont;
@@ -1851,10 +1955,11 @@ void BinCalibToolWidget::Calib_MasterStruct(FileBin_VarInfoType* node)
     for (FileBin_VarInfoType* cur = node; cur != nullptr; cur = cur->next)
     {
         QString displayName = "unnamed";
+        std::string_view curName = this->DWARFData->GetName(cur->nameId);
 
-        if (!cur->data.empty())
+        if (!curName.empty())
         {
-            const QString fullPath = QString::fromUtf8(reinterpret_cast<const char*>(cur->data.data()), static_cast<int>(cur->data.size()));
+            const QString fullPath = QString::fromUtf8(curName.data(), static_cast<int>(curName.size()));
 
             displayName = QFileInfo(fullPath).fileName();
         }
@@ -1863,9 +1968,31 @@ void BinCalibToolWidget::Calib_MasterStruct(FileBin_VarInfoType* node)
         item->setText(0, displayName);
         item->setFlags(item->flags() & ~Qt::ItemIsEditable);
 
-        if (cur->data.empty())
+        if (curName.empty())
         {
             item->setFont(0, italicFont);
         }
     }
+
+    /* Same unit as before the reload, its symbols and base file values are read again from the new nodes */
+    int unitIdx = 0;
+    for (FileBin_VarInfoType* cur = node; cur != nullptr; cur = cur->next, unitIdx++)
+    {
+        std::string_view curName = this->DWARFData->GetName(cur->nameId);
+
+        if (!this->selectedUnitPath.isEmpty() && (this->selectedUnitPath == QString::fromUtf8(curName.data(), static_cast<int>(curName.size()))))
+        {
+            QTreeWidgetItem* item = m_treeWidget->topLevelItem(unitIdx);
+            m_treeWidget->setCurrentItem(item);
+            this->onTreeItemClicked(item, 0);
+            return;
+        }
+    }
+
+    /* Nothing to show, the previous widgets point into the old symbol tree */
+    m_symbolTree->clear();
+    for (SymbolDataInfo* baseFile : this->BaseFileData)
+    {
+        baseFile->data.clear();
+    }
 }
@@ -41,6 +41,7 @@
 #include <QSplitter>
 #include <qtreewidget.h>
 #include <qtoolbar.h>
+#include <unordered_map>
 #include "FileBin_DWARF.h"
 #include "FileBin_ELF.h"
 #include "FileBin_IntelHex.hpp"
@@ -57,6 +58,7 @@ struct DwarfSymbol {
 typedef struct SymbolData
 {
     FileBin_DWARF_VarInfoType* node;
+    uint64_t Addr; // Absolute address, nodes of a shared type layout only hold an offset
     QWidget *WidgetData;
 } SymbolDataType;
 
@@ -80,7 +82,7 @@ class BinCalibToolWidget : public QWidget
     Q_OBJECT
 
 public:
-    explicit BinCalibToolWidget(QWidget *parent = nullptr, FileBin_ELF * elf = nullptr);
+    explicit BinCalibToolWidget(QWidget *parent = nullptr, FileBin_ELF * elf = nullptr, FileBin_DWARF * dwarf = nullptr);
 
     // Public API to feed the widget data
     void loadSymbols(FileBin_VarInfoType* node);
@@ -88,7 +90,7 @@ public:
     void AddNewBaseFile(std::string filename);
 
 
-    void GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType* node);
+    void GenerateTable(uint8_t BaseFileIdx, FileBin_VarInfoType* node, uint64_t addr);
 
 
     DataValue readMem(uint32_t BaseFileIdx, uint32_t Addr, FileBin_IntelHex_Memory *newFileBin);
@@ -96,9 +98,11 @@ public:
     void Calib_MasterStruct(FileBin_VarInfoType* node); // Generate master struct of source ifles
     void Calib_MasterSymbolShow(QTreeWidgetItem* item, int column); // Add master symbol list according to selected file
     void Calib_BaseFile_AddNew(std::string filename, FileBin_IntelHex_Memory *newFileBin); // Add new base file
-    void Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node, QTreeWidgetItem* item, uint32_t rowIdx); // Add base file widgets
+    void Calib_BaseFile_WidgetPopulate(FileBin_VarInfoType* node, QTreeWidgetItem* item, uint32_t rowIdx, uint64_t baseAddr = 0); // Add base file widgets
     void Calib_BaseFile_DataParse(FileBin_VarInfoType* node, uint32_t BaseFileIdx, FileBin_IntelHex_Memory *newFileBin); // Parse base file into widgets
     void Calib_BaseFile_Remove(uint32_t BaseFileIdx); // Add new base file
+    void Calib_DefaultValuePrefetch(FileBin_VarInfoType* node); // Batch read ELF default values of a symbol list
+    const uint8_t* Calib_DefaultValueGet(uint64_t addr) const; // Prefetched ELF default value, nullptr if not available
 
     void hideTable(void);
 
@@ -115,7 +119,10 @@ private:
 
     FileBin_DWARF_VarInfoType* SymbolData;
     FileBin_DWARF_VarInfoType* selectedSymbolData = nullptr;
+    QString selectedUnitPath; // Unit shown in the symbol tree, selected again when the ELF is reloaded
     FileBin_ELF* ELFData;
+    FileBin_DWARF* DWARFData; // Resolves unit variables on first selection when parsed lazily
+    std::unordered_map<uint64_t, const uint8_t*> DefaultValue; // Views into the mapped ELF for the selected unit, by symbol address
     //std::vector<FileBaseInfo> BaseFile;
     bool IsMasterFileLoaded;
     vector<SymbolDataInfo *> BaseFileData;
@@ -135,7 +142,8 @@ private:
 
     QTreeWidgetItem* copyItemWithoutColumn(QTreeWidgetItem* item, int colToRemove);
     void loadSymbolData(FileBin_VarInfoType* node, QTreeWidgetItem* item, uint32_t rowIdx, uint32_t colIdx, uint32_t BaseFileColIdx);
-    void populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType* node, QTreeWidgetItem* parentItem = nullptr);
+    void Calib_DefaultValueCollect(FileBin_VarInfoType* node, uint64_t baseAddr, std::vector<SymbolReadRequest>& requests);
+    void populateTreeWidgetRecursive(FileBin_DWARF_VarInfoType* node, QTreeWidgetItem* parentItem = nullptr, uint64_t baseAddr = 0);
    // void RefreshBaseFile(void);
     void BinMemWrite(FileBin_VarInfoType *InfoNode, uint32_t BinIdx, uint32_t SymbolIdx);
 
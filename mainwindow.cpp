@@ -45,6 +45,8 @@
 #include <QDropEvent>
 #include <QMimeData>
 #include <QUrl>
+#include <QDir>
+#include <QStandardPaths>
 #include <QFileInfo>
 #include <QMetaType>
 #include "WidgetBinCalib.hpp"
@@ -69,6 +71,7 @@ QIcon rotateIcon(const QIcon &icon, qreal angle)
 }
 
 Q_DECLARE_METATYPE(FileBin_VarInfoType*)
+Q_DECLARE_METATYPE(FileBin_DWARF_DieCursor)
 
 FileBin_ELF *elf;
 FileBin_DWARF *dwarf;
@@ -93,37 +96,7 @@ static std::string TagToString(uint32_t tag)
     }
 }
 
-void populateModelRecursive(TreeElementType* node, QStandardItem* parentItem)
-{
-    static QFont italicFont;
-    italicFont.setItalic(true);
-
-    while (node)
-    {
-        QString displayName = node->data.empty()
-        ? "unnamed"
-        : QString::fromUtf8(reinterpret_cast<const char*>(node->data.data()), node->data.size());
-
-        QStandardItem* nameItem = new QStandardItem(displayName);
-        QStandardItem* tagItem  = new QStandardItem(QString::fromStdString(TagToString(node->elementType)));
-
-        // Make read-only
-        nameItem->setFlags(nameItem->flags() & ~Qt::ItemIsEditable);
-        tagItem->setFlags(tagItem->flags() & ~Qt::ItemIsEditable);
-
-        if (node->data.empty())
-            nameItem->setFont(italicFont);
-
-        parentItem->appendRow({ nameItem, tagItem });
-
-        if (node->child)
-            populateModelRecursive(node->child, nameItem);
-
-        node = node->next;
-    }
-}
-
-static QString formatSize(const std::vector<uint32_t>& size)
+static QString formatSize(const FileBin_DWARF_SizeType& size)
 {
     if (size.empty())
         return {};
@@ -146,12 +119,12 @@ static QString formatSize(const std::vector<uint32_t>& size)
 
 static QString extractDisplayName(const FileBin_VarInfoType* node)
 {
-    if (node->data.empty())
+    std::string_view nodeName = dwarf->GetName(node->nameId);
+
+    if (nodeName.empty())
         return QStringLiteral("unnamed");
 
-    QString name = QString::fromStdString(
-        std::string(node->data.begin(), node->data.end())
-        );
+    QString name = QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size()));
 
     if (node->elementType == FILEBIN_DWARF_ELEMENT_COMPILE_UNIT) {
         name = QFileInfo(name).fileName();
@@ -183,7 +156,7 @@ static QString formatType(uint32_t typeId)
     }
 }
 
-void populateModelRecursiveSymbol(FileBin_VarInfoType* node, QStandardItem* parentItem)
+void populateModelRecursiveSymbol(FileBin_VarInfoType* node, QStandardItem* parentItem, uint64_t baseAddr = 0)
 {
     static QFont italicFont;
     italicFont.setItalic(true);
@@ -193,13 +166,15 @@ void populateModelRecursiveSymbol(FileBin_VarInfoType* node, QStandardItem* pare
     while (node)
     {
         QStandardItem* nameItem = parentItem;
+        uint64_t absAddr = baseAddr + node->Addr; // Type layout nodes hold an offset from their parent
 
         if (!node->isQualifier)
         {
-            QString name = node->data.empty()
+            std::string_view nodeName = dwarf->GetName(node->nameId);
+            QString name = nodeName.empty()
             ? "unnamed"
-            : QString::fromUtf8(reinterpret_cast<const char*>(node->data.data()), node->data.size());
-            QString addr = QString::asprintf("0x%X", node->Addr);
+            : QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size()));
+            QString addr = QStringLiteral("0x") + QString::number(absAddr, 16).toUpper();
             QString size = formatSize(node->Size);
             QString type = formatType(node->DataType);
 
@@ -221,11 +196,12 @@ void populateModelRecursiveSymbol(FileBin_VarInfoType* node, QStandardItem* pare
             typeItem->setTextAlignment(Qt::AlignHCenter);
 
             // Italic for unnamed nodes
-            if (node->data.empty())
+            if (nodeName.empty())
                 nameItem->setFont(italicFont);
 
             // Store the pointer to this node in Qt::UserRole
             nameItem->setData(QVariant::fromValue(node), Qt::UserRole);
+            nameItem->setData(static_cast<qulonglong>(absAddr), Qt::UserRole + 2);
 
             // Append row to parent
             parentItem->appendRow({ nameItem, addrItem, sizeItem, typeItem });
@@ -233,7 +209,7 @@ void populateModelRecursiveSymbol(FileBin_VarInfoType* node, QStandardItem* pare
 
         // Recursive call for children
         if (node->child)
-            populateModelRecursiveSymbol(node->child, nameItem);
+            populateModelRecursiveSymbol(node->child, nameItem, absAddr);
 
         node = node->next;
     }
@@ -292,42 +268,43 @@ void beautifyTreeView(Ui::MainWindow *ui, QTreeView* view)
 }
 
 
-void populateTopLevel(TreeElementType* node, QStandardItem* parentItem)
+void populateTopLevel(FileBin_DWARF_DieCursor node, QStandardItem* parentItem)
 {
     static QFont italicFont;
     italicFont.setItalic(true);
 
-    while (node)
+    while (node.Valid())
     {
-        QString displayName = node->data.empty()
+        std::string_view nodeName = dwarf->GetName(node.NameId());
+        QString displayName = nodeName.empty()
         ? "unnamed"
-        : QString::fromUtf8(reinterpret_cast<const char*>(node->data.data()), node->data.size());
+        : QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size()));
 
         QStandardItem* nameItem = new QStandardItem(displayName);
-        QStandardItem* tagItem  = new QStandardItem(QString::fromStdString(TagToString(node->elementType)));
+        QStandardItem* tagItem  = new QStandardItem(QString::fromStdString(TagToString(node.Tag())));
 
         // Make read-only
         nameItem->setFlags(nameItem->flags() & ~Qt::ItemIsEditable);
         tagItem->setFlags(tagItem->flags() & ~Qt::ItemIsEditable);
 
-        if (node->data.empty())
+        if (nodeName.empty())
             nameItem->setFont(italicFont);
 
         parentItem->appendRow({ nameItem, tagItem });
 
-        // If node has children, add a **dummy child** as a placeholder
-        if (node->child)
+        // If node has children (decoded or not yet), add a **dummy child** as a placeholder
+        if (node.HasChildren())
         {
             QStandardItem* placeholder = new QStandardItem("Loading...");
             placeholder->setFlags(Qt::ItemIsEnabled);      // must be enabled to show expand arrow
             placeholder->setData(true, Qt::UserRole + 1);  // mark as placeholder
             nameItem->appendRow(placeholder);
 
-            // Store a pointer to the actual TreeElementType in item data
-            nameItem->setData(QVariant::fromValue(reinterpret_cast<void*>(node->child)), Qt::UserRole);
+            // Store the cursor of the DIE in item data, children are fetched on expand
+            nameItem->setData(QVariant::fromValue(node), Qt::UserRole);
         }
 
-        node = node->next;
+        node = node.Next();
     }
 }
 
@@ -340,9 +317,10 @@ void MainWindow::populateTopLevelSymbol(FileBin_VarInfoType* node, QStandardItem
 
     while (node)
     {
-        QString displayName = node->data.empty()
+        std::string_view nodeName = dwarf->GetName(node->nameId);
+        QString displayName = nodeName.empty()
         ? "unnamed"
-        : QString::fromUtf8(reinterpret_cast<const char*>(node->data.data()), node->data.size());
+        : QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size()));
 
         QStandardItem* nameItem = new QStandardItem(displayName);
         QStandardItem* tagItem  = new QStandardItem(QString::fromStdString(TagToString(node->elementType)));
@@ -351,21 +329,21 @@ void MainWindow::populateTopLevelSymbol(FileBin_VarInfoType* node, QStandardItem
         nameItem->setFlags(nameItem->flags() & ~Qt::ItemIsEditable);
         tagItem->setFlags(tagItem->flags() & ~Qt::ItemIsEditable);
 
-        if (node->data.empty())
+        if (nodeName.empty())
             nameItem->setFont(italicFont);
 
         parentItem->appendRow({ nameItem, tagItem });
 
-        // If node has children, add a **dummy child** as a placeholder
-        if (node->child)
+        // If node has children (or is a unit not resolved yet), add a **dummy child** as a placeholder
+        if (node->child || dwarf->IsLazy())
         {
             QStandardItem* placeholder = new QStandardItem("Loading...");
             placeholder->setFlags(Qt::ItemIsEnabled);      // must be enabled to show expand arrow
             placeholder->setData(true, Qt::UserRole + 1);  // mark as placeholder
             nameItem->appendRow(placeholder);
 
-            // Store a pointer to the actual TreeElementType in item data
-            nameItem->setData(QVariant::fromValue(reinterpret_cast<void*>(node->child)), Qt::UserRole);
+            // Store a pointer to the unit symbol in item data, its variables are fetched on expand
+            nameItem->setData(QVariant::fromValue(reinterpret_cast<void*>(node)), Qt::UserRole);
         }
 
         node = node->next;
@@ -376,6 +354,7 @@ void MainWindow::populateTopLevelSymbol(FileBin_VarInfoType* node, QStandardItem
 }
 
 QStandardItemModel *model, *modelSymbol;
+QStandardItemModel *modelSearch, *modelSymbolSearch; // Flat search results shown in place of the trees
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -506,8 +485,9 @@ QToolButton:checked {
     //this->setStyleSheet(buttonStyle);
     elf = new FileBin_ELF();
     dwarf = new FileBin_DWARF();
+    dwarf->SetLazy(true); // Only unit headers up front, the rest is decoded as trees are expanded
 
-    this->ui_BinCalibWidget = new BinCalibToolWidget(this, elf);
+    this->ui_BinCalibWidget = new BinCalibToolWidget(this, elf, dwarf);
 
     // Force the menubar to be strictly the height of its contents
     ui->menubar->setContentsMargins(0, 0, 0, 0);
@@ -544,6 +524,13 @@ QToolButton:checked {
     ui->treeView_2->setModel(modelSymbol);
 
     ui->treeView_2->setFocusPolicy(Qt::NoFocus);
+
+    modelSearch = new QStandardItemModel(this);
+    modelSymbolSearch = new QStandardItemModel(this);
+
+    // Search as you type, results replace the tree until the filter is cleared
+    connect(ui->lineEdit_searchDIE, &QLineEdit::textChanged, this, &MainWindow::applyDIEFilter);
+    connect(ui->lineEdit_searchSymbol, &QLineEdit::textChanged, this, &MainWindow::applySymbolFilter);
     //ui->->setFocusPolicy(Qt::NoFocus);
 
     ui->tabWidget_2->addTab(this->ui_BinCalibWidget, "Calibrator");
@@ -602,7 +589,7 @@ MainWindow::~MainWindow()
     delete ui;
 }
 
-void MainWindow::displayBinaryFile(FileBin_VarInfoType *symbol)
+void MainWindow::displayBinaryFile(FileBin_VarInfoType *symbol, uint64_t addr)
 {
     if (!symbol || !elf)
         return;
@@ -611,7 +598,7 @@ void MainWindow::displayBinaryFile(FileBin_VarInfoType *symbol)
         return;
 
     // Read symbol bytes from ELF
-    std::vector<uint8_t> data = elf->readSymbolFromELF(symbol->Addr, symbol->Size.at(0));
+    std::vector<uint8_t> data = elf->readSymbolFromELF(addr, symbol->Size.at(0));
 
     const int bytesPerLine = 16;        // 16 bytes per line
     QString hexDump;
@@ -621,7 +608,7 @@ void MainWindow::displayBinaryFile(FileBin_VarInfoType *symbol)
         QString line;
 
         // First column: memory address
-        line += QString("0x%1: ").arg(symbol->Addr, 8, 16, QChar('0')).toUpper();
+        line += QString("0x%1: ").arg(addr, 8, 16, QChar('0')).toUpper();
 
         // Hex bytes column
         for (int j = 0; j < bytesPerLine; ++j)
@@ -668,7 +655,9 @@ void MainWindow::onTreeSelectionChanged(const QItemSelection &selected, const QI
     if (!index.isValid())
         return;
 
-    QStandardItem* item = modelSymbol->itemFromIndex(index);
+    // Symbol tree or search results, whichever is shown
+    auto viewModel = qobject_cast<QStandardItemModel*>(ui->treeView_2->model());
+    QStandardItem* item = viewModel ? viewModel->itemFromIndex(index) : nullptr;
     if (!item)
         return;
 
@@ -682,7 +671,99 @@ void MainWindow::onTreeSelectionChanged(const QItemSelection &selected, const QI
         return;
 
     // Now, you can update your QTextEdit with the binary content
-    displayBinaryFile(node);
+    displayBinaryFile(node, item->data(Qt::UserRole + 2).toULongLong());
+}
+
+void MainWindow::applySymbolFilter(const QString &text)
+{
+    QStandardItemModel* shown = modelSymbol;
+
+    if (!text.isEmpty())
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        QByteArray query = text.toUtf8();
+        std::vector<FileBin_VarInfoType*> hits = dwarf->SearchSymbols(std::string_view(query.constData(), query.size()));
+
+        modelSymbolSearch->clear();
+        modelSymbolSearch->setHorizontalHeaderLabels({"Name", "Value", "Size", "Type"});
+
+        for (FileBin_VarInfoType* node : hits)
+        {
+            bool isUnit = (node->elementType == FILEBIN_DWARF_ELEMENT_COMPILE_UNIT);
+
+            std::string_view nodeName = dwarf->GetName(node->nameId);
+            QStandardItem* nameItem = new QStandardItem(QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size())));
+            QStandardItem* addrItem = new QStandardItem(isUnit ? QString() : (QStringLiteral("0x") + QString::number(node->Addr, 16).toUpper()));
+            QStandardItem* sizeItem = new QStandardItem(formatSize(node->Size));
+            QStandardItem* typeItem = new QStandardItem(isUnit ? QString::fromStdString(TagToString(node->elementType)) : formatType(node->DataType));
+
+            for (QStandardItem* cell : { nameItem, addrItem, sizeItem, typeItem })
+            {
+                cell->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+            }
+            addrItem->setTextAlignment(Qt::AlignHCenter);
+            sizeItem->setTextAlignment(Qt::AlignHCenter);
+            typeItem->setTextAlignment(Qt::AlignHCenter);
+
+            // Variables hold their absolute address, same roles as the symbol tree
+            nameItem->setData(QVariant::fromValue(node), Qt::UserRole);
+            nameItem->setData(static_cast<qulonglong>(node->Addr), Qt::UserRole + 2);
+
+            modelSymbolSearch->appendRow({ nameItem, addrItem, sizeItem, typeItem });
+        }
+
+        float duration_ms = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0f;
+        this->statusBar()->showMessage(QString("%1 symbols found in %2 ms").arg(hits.size()).arg(duration_ms, 0, 'f', 2), 0);
+
+        shown = modelSymbolSearch;
+    }
+
+    if (ui->treeView_2->model() != shown)
+    {
+        // A new selection model comes with the model
+        ui->treeView_2->setModel(shown);
+        connect(ui->treeView_2->selectionModel(), &QItemSelectionModel::selectionChanged,
+                this, &MainWindow::onTreeSelectionChanged);
+    }
+}
+
+void MainWindow::applyDIEFilter(const QString &text)
+{
+    QStandardItemModel* shown = model;
+
+    if (!text.isEmpty())
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        QByteArray query = text.toUtf8();
+        std::vector<FileBin_DWARF_DieCursor> hits = dwarf->SearchDIEs(std::string_view(query.constData(), query.size()));
+
+        modelSearch->clear();
+        modelSearch->setHorizontalHeaderLabels({"Name", "Value"});
+
+        for (const FileBin_DWARF_DieCursor& node : hits)
+        {
+            std::string_view nodeName = dwarf->GetName(node.NameId());
+            QStandardItem* nameItem = new QStandardItem(QString::fromUtf8(nodeName.data(), static_cast<int>(nodeName.size())));
+            QStandardItem* tagItem  = new QStandardItem(QString::fromStdString(TagToString(node.Tag())));
+
+            nameItem->setFlags(nameItem->flags() & ~Qt::ItemIsEditable);
+            tagItem->setFlags(tagItem->flags() & ~Qt::ItemIsEditable);
+
+            modelSearch->appendRow({ nameItem, tagItem });
+        }
+
+        float duration_ms = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0f;
+        this->statusBar()->showMessage(QString("%1 DIEs found in %2 ms").arg(hits.size()).arg(duration_ms, 0, 'f', 2), 0);
+
+        shown = modelSearch;
+    }
+
+    if (ui->treeView->model() != shown)
+    {
+        ui->treeView->setModel(shown);
+    }
 }
 
 void MainWindow::loadElf(std::string file_name)
@@ -694,6 +775,14 @@ void MainWindow::loadElf(std::string file_name)
     //elf = nullptr;
     //dwarf = nullptr;
 
+    // Rebuilt firmware: unchanged units are kept and the selected symbol is looked up again by its path
+    bool reload = (file_name == this->elfFileName);
+    QStringList selection = reload ? selectedSymbolPath() : QStringList();
+
+    // Results point into the previous parse, back to the trees first
+    ui->lineEdit_searchDIE->clear();
+    ui->lineEdit_searchSymbol->clear();
+
     model->clear();
     modelSymbol->clear();
 
@@ -707,18 +796,53 @@ void MainWindow::loadElf(std::string file_name)
 
     if (elf->IsDWARF())
     {
-        dwarf->Parse(
-            file_name,
-            elf->GetAbbrevOffset(),
-            elf->GetAbbrevLen(),
-            elf->GetInfoOffset(),
-            elf->GetInfoLen(),
-            elf->GetStrOffset()
-            );
+        // Symbol database of previously opened files, keyed by the ELF content
+        QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/symbols";
+        if (QDir().mkpath(cacheDir))
+        {
+            dwarf->SetCache(cacheDir.toStdString(), elf->GetContentKey());
+        }
+
+        FileBin_DWARF_SectionsType sections;
+        sections.LineStrOffset = elf->GetLineStrOffset();
+        sections.LineStrLen = elf->GetLineStrLen();
+        sections.StrOffsetsOffset = elf->GetStrOffsetsOffset();
+        sections.StrOffsetsLen = elf->GetStrOffsetsLen();
+        sections.AddrOffset = elf->GetAddrOffset();
+        sections.AddrLen = elf->GetAddrLen();
+        sections.TypesOffset = elf->GetTypesOffset();
+        sections.TypesLen = elf->GetTypesLen();
+        dwarf->SetSections(sections);
+
+        if (reload)
+        {
+            dwarf->Reload(
+                file_name,
+                elf->GetAbbrevOffset(),
+                elf->GetAbbrevLen(),
+                elf->GetInfoOffset(),
+                elf->GetInfoLen(),
+                elf->GetStrOffset(),
+                elf->GetByteOrder()
+                );
+        }
+        else
+        {
+            dwarf->Parse(
+                file_name,
+                elf->GetAbbrevOffset(),
+                elf->GetAbbrevLen(),
+                elf->GetInfoOffset(),
+                elf->GetInfoLen(),
+                elf->GetStrOffset(),
+                elf->GetByteOrder()
+                );
+        }
+        this->elfFileName = file_name;
 
 
 
-        TreeElementType* rootNode = dwarf->DataRoot;
+        FileBin_DWARF_DieCursor rootNode = dwarf->DataRoot;
         QStandardItem* rootItem = model->invisibleRootItem();
 
         ui->treeView->setUpdatesEnabled(false);
@@ -755,9 +879,8 @@ void MainWindow::loadElf(std::string file_name)
                         QVariant var = item->data(Qt::UserRole);
                         if (var.isValid())
                         {
-                            auto* childNode =
-                                reinterpret_cast<TreeElementType*>(var.value<void*>());
-                            populateModelRecursive(childNode, item);
+                            FileBin_DWARF_DieCursor parentNode = var.value<FileBin_DWARF_DieCursor>();
+                            populateTopLevel(dwarf->GetChildren(parentNode), item);
                             item->setData(QVariant(), Qt::UserRole);
                         }
                     }
@@ -780,13 +903,15 @@ void MainWindow::loadElf(std::string file_name)
                         QVariant var = item->data(Qt::UserRole);
                         if (var.isValid())
                         {
-                            auto* childNode =
+                            auto* unitNode =
                                 reinterpret_cast<FileBin_VarInfoType*>(var.value<void*>());
-                            populateModelRecursiveSymbol(childNode, item);
+                            populateModelRecursiveSymbol(dwarf->GetUnitSymbols(unitNode), item);
                             item->setData(QVariant(), Qt::UserRole);
                         }
                     }
                 });
+
+        selectSymbolPath(selection);
     }
 
 
@@ -808,6 +933,50 @@ void MainWindow::loadElf(std::string file_name)
     beautifyTreeView(ui, ui->treeView_2);
 }
 
+QStringList MainWindow::selectedSymbolPath(void) const
+{
+    QStringList path;
+
+    // Search results have no tree to walk back up
+    if (ui->treeView_2->model() != modelSymbol)
+        return path;
+
+    for (QModelIndex index = ui->treeView_2->currentIndex().siblingAtColumn(0); index.isValid(); index = index.parent())
+    {
+        path.prepend(index.data().toString());
+    }
+
+    return path;
+}
+
+void MainWindow::selectSymbolPath(const QStringList& path)
+{
+    QModelIndex found;
+
+    for (const QString& name : path)
+    {
+        // Expanding fetches the children of lazily populated items
+        if (found.isValid())
+            ui->treeView_2->expand(found);
+
+        QModelIndex first = modelSymbol->index(0, 0, found);
+        if (!first.isValid())
+            break;
+
+        QModelIndexList hits = modelSymbol->match(first, Qt::DisplayRole, name, 1, Qt::MatchExactly);
+        if (hits.isEmpty())
+            break;
+
+        found = hits.first();
+    }
+
+    if (found.isValid())
+    {
+        ui->treeView_2->setCurrentIndex(found);
+        ui->treeView_2->scrollTo(found);
+    }
+}
+
 void MainWindow::AddNewBaseFile(QString Filename)
 {
     FileBin_IntelHex_Memory *newBaseFile = new FileBin_IntelHex_Memory();
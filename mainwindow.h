@@ -67,11 +67,16 @@ class MainWindow : public QMainWindow
     private:
         Ui::MainWindow *ui;
         BinCalibToolWidget *ui_BinCalibWidget;
+        std::string elfFileName; // Loaded ELF, opening it again only re-parses the units that changed
 
         void loadElf(std::string file_name);
         void onTreeSelectionChanged(const QItemSelection &selected, const QItemSelection &deselected);
-        void displayBinaryFile(FileBin_VarInfoType *symbol);
+        void displayBinaryFile(FileBin_VarInfoType *symbol, uint64_t addr);
+        void applySymbolFilter(const QString &text);
+        void applyDIEFilter(const QString &text);
         void populateTopLevelSymbol(FileBin_VarInfoType* node, QStandardItem* parentItem);
+        QStringList selectedSymbolPath(void) const;
+        void selectSymbolPath(const QStringList& path);
         void AddNewBaseFile(QString Filename);
 };
 #endif // MAINWINDOW_H